@@ -0,0 +1,168 @@
+/**
+ * @file autotuner.h
+ * @brief This file contains the automatic choice of the transformation and its order
+ */
+
+#pragma once
+#include <memory>  // Include the memory library for std::unique_ptr
+#include <vector>  // Include the vector library
+#include <cmath>   // Include the cmath library for std::abs and std::isfinite
+#include <limits>  // Include the limits library for the infinity
+#include "convergence_driver.h"
+
+/**
+ * @brief The choice made by the autotuner
+ * @tparam T The type of the elements in the series, K The type of enumerating integer
+ */
+template <typename T, typename K>
+struct autotune_result
+{
+	/**
+   * @brief The id the transformation was added to the autotuner with
+   */
+	int transformation_id = 0;
+
+	/**
+   * @brief The order of the transformation
+   */
+	int order = 0;
+
+	/**
+   * @brief The number of terms n of the chosen transformed partial sum T_n
+   */
+	K n = 0;
+
+	/**
+   * @brief The chosen transformed partial sum T_n
+   */
+	T estimate = 0;
+
+	/**
+   * @brief The larger of the last two differences |T_n - T_{n-1}| and |T_{n-1} - T_{n-2}|
+   */
+	T error_estimate = std::numeric_limits<T>::infinity();
+
+	/**
+   * @brief The cost of T_n in the model of the autotuner
+   */
+	double cost = std::numeric_limits<double>::infinity();
+
+	/**
+   * @brief Whether the tolerance was reached, otherwise the result is the most stable estimate found on the prefix
+   */
+	bool converged = false;
+};
+
+/**
+ * @brief Autotuner of the transformation and its order
+ * Every candidate transformation computes the transformed partial sums T_1, ..., T_prefix of every order up to max_order in a single sweep_orders call.
+ * The estimates T_n are stable when two consecutive differences |T_n - T_{n-1}| and |T_{n-1} - T_{n-2}| do not exceed tolerance * max(1, |T_n|), see stability_error.
+ * The cost of T_n is term_cost * terms_required(n, order) + operations_required(n, order), the autotuner picks the cheapest stable estimate.
+ * Since the transformed partial sums of the order k are undefined for small n (e.g. the Shanks transformation returns 0 for n < k), only n > k + 1 are considered.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class autotuner
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the autotuner.
+   * @param tolerance The requested tolerance, it must be positive
+   * @param prefix The number of terms of the last transformed partial sum examined
+   * @param max_order The highest order of transformation examined
+   * @param term_cost The cost of a single term of the series measured in arithmetic operations
+   */
+	autotuner(const T tolerance, const K prefix = 64, const int max_order = 4, const double term_cost = 16);
+
+	/**
+   * @brief Adds the transformation to the candidates.
+   * @param transformation_id The id of the transformation reported in autotune_result
+   * @param transformation The transformation
+   */
+	void add_candidate(const int transformation_id, std::unique_ptr<series_acceleration<T, K, series_templ>> transformation);
+
+	/**
+   * @brief Tries all the candidates on the prefix and picks the cheapest transformation and order reaching the tolerance.
+   * The estimates the candidates fail to compute are non-finite and skipped.
+   * @return The choice, if no candidate reaches the tolerance it is the one with the smallest error estimate
+   */
+	autotune_result<T, K> operator()() const;
+
+private:
+	/**
+   * @brief The requested tolerance
+   */
+	const T tolerance;
+
+	/**
+   * @brief The number of terms of the last transformed partial sum examined
+   */
+	const K prefix;
+
+	/**
+   * @brief The highest order of transformation examined
+   */
+	const int max_order;
+
+	/**
+   * @brief The cost of a single term of the series measured in arithmetic operations
+   */
+	const double term_cost;
+
+	/**
+   * @brief The candidate transformations with their ids
+   */
+	std::vector<std::pair<int, std::unique_ptr<series_acceleration<T, K, series_templ>>>> candidates;
+};
+
+template <typename T, typename K, typename series_templ>
+autotuner<T, K, series_templ>::autotuner(const T tolerance, const K prefix, const int max_order, const double term_cost) :
+	tolerance(tolerance), prefix(prefix), max_order(max_order), term_cost(term_cost)
+{
+	if (!(tolerance > 0))
+		throw std::domain_error("the tolerance must be positive");
+	if (prefix < 3)
+		throw std::domain_error("the prefix must contain at least 3 terms");
+	if (max_order < 0)
+		throw std::domain_error("negative integer in the input");
+}
+
+template <typename T, typename K, typename series_templ>
+void autotuner<T, K, series_templ>::add_candidate(const int transformation_id, std::unique_ptr<series_acceleration<T, K, series_templ>> transformation)
+{
+	candidates.emplace_back(transformation_id, std::move(transformation));
+}
+
+template <typename T, typename K, typename series_templ>
+autotune_result<T, K> autotuner<T, K, series_templ>::operator()() const
+{
+	autotune_result<T, K> best;
+	for (const auto& [id, transformation] : candidates)
+	{
+		const auto estimates = transformation->sweep_orders(prefix, max_order); // the failed estimates are non-finite
+
+		for (int order = 0; order <= max_order; ++order)
+		{
+			const auto& row = estimates[order];
+			for (K n = order + 2; n < prefix; ++n)
+			{
+				// row[n] is T_{n+1}
+				const T c = row[n];
+				const T error = stability_error(row[n - 2], row[n - 1], c);
+				if (!series_math::isfinite(error))
+					continue;
+				const double cost = term_cost * transformation->terms_required(n + 1, order) + transformation->operations_required(n + 1, order);
+				const bool converged = error <= tolerance * std::max<T>(1, series_math::abs(c));
+				if (converged)
+				{
+					if (!best.converged || cost < best.cost)
+						best = { id, order, static_cast<K>(n + 1), c, error, cost, true };
+					break; // the cost grows with n
+				}
+				if (!best.converged && error < best.error_estimate)
+					best = { id, order, static_cast<K>(n + 1), c, error, cost, false };
+			}
+		}
+	}
+	return best;
+}
@@ -0,0 +1,193 @@
+/**
+ * @file batch_acceleration.h
+ * @brief This file contains the Shanks transformation and the Epsilon Algorithm for the batches of series from series_batch.h
+ * Every entry of their tables is a row of lanes, one per argument of the batch, and every step of the recurrences updates the whole row
+ * with SIMD instructions, so the throughput grows with the vector width rather than with the number of the series objects.
+ * The lanes are independent: like series_acceleration::evaluate, the transformations do not throw on the division by zero
+ * and return a non-finite value in the lanes where it happened.
+ */
+
+#pragma once
+
+#include <vector> // Include the vector library
+#include <algorithm> // Include the algorithm library for std::copy_n and std::max
+#include "series_batch.h"
+#include "series_acceleration.h" // Include the series_acceleration header for DEF_UNDEFINED_SUM
+
+/**
+* @brief Shanks transformation of a batch of series
+* The lane j of the result is the Shanks transformation of the series at the argument j, see shanks_transform.
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class shanks_transform_batch
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Shanks transformation of the batch.
+   * @param batch The batch of series to be accelerated
+   */
+	shanks_transform_batch(const series_batch<T, K>& batch);
+
+	/**
+   * @brief Computes the partial sums after the transformation for all the arguments of the batch.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation.
+   * @return The vector of batch.size() partial sums after the transformation.
+   */
+	std::vector<T> operator()(const K n, const int order) const;
+
+private:
+	/**
+   * @brief The batch whose convergence we accelerate
+   */
+	const series_batch<T, K>& batch;
+};
+
+template <typename T, typename K>
+shanks_transform_batch<T, K>::shanks_transform_batch(const series_batch<T, K>& batch) : batch(batch) {}
+
+template <typename T, typename K>
+std::vector<T> shanks_transform_batch<T, K>::operator()(const K n, const int order) const
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	if (n < 0 || order < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<T> result(batch.size(), DEF_UNDEFINED_SUM);
+	if (order != 0 && (n < order || n == 0))
+		return result;
+
+	const K last = n + order; // the window of the first order transformations needs a_{n-order+1}, ..., a_{n+order}
+	const K first = n - order + 1;
+	const std::size_t window = order > 0 ? 2 * order - 1 : 0;
+	const std::size_t L = batch.lanes();
+	const std::size_t max_tile = std::min(L, series_batch<T, K>::tile_lanes);
+	std::vector<T> terms((last + 1) * max_tile);
+	std::vector<T> partial_sums(terms.size());
+	std::vector<T> workspace(window * max_tile);
+	const auto one = pack::broadcast(1);
+	const auto two = pack::broadcast(2);
+	for (std::size_t lane = 0; lane < L; lane += max_tile)
+	{
+		const std::size_t tile = std::min(max_tile, L - lane);
+		const std::size_t returned = std::min(tile, result.size() - lane); // the padding lanes are not returned
+		batch.fill_terms_and_partial_sums(last, lane, tile, std::span<T>(terms).first((last + 1) * tile), std::span<T>(partial_sums).first((last + 1) * tile));
+		if (order == 0)
+		{
+			std::copy_n(&partial_sums[n * tile], returned, result.begin() + lane);
+			continue;
+		}
+
+		// the row k holds the transformation at i = n - order + 1 + k, the window shrinks by one from both sides on every order
+		for (std::size_t k = 0; k < window; ++k)
+		{
+			const std::size_t i = (first + k) * tile;
+			for (std::size_t j = 0; j < tile; j += width)
+			{
+				// formula [6]
+				const auto a_n = pack::load(&terms[i + j]);
+				const auto a_n_plus_1 = pack::load(&terms[i + tile + j]);
+				const auto tmp = -a_n_plus_1 * a_n_plus_1;
+				fma(a_n * a_n_plus_1, (a_n + a_n_plus_1) / (fma(a_n, a_n, tmp) - fma(a_n_plus_1, a_n_plus_1, tmp)), pack::load(&partial_sums[i + j])).store(&workspace[k * tile + j]);
+			}
+		}
+		for (int j_order = 2; j_order <= order; ++j_order)
+			for (std::size_t j = 0; j < tile; j += width)
+			{
+				auto b = pack::load(&workspace[(j_order - 2) * tile + j]);
+				for (std::size_t k = j_order - 1; k <= window - j_order; ++k)
+				{
+					const auto a = pack::load(&workspace[k * tile + j]);
+					const auto c = pack::load(&workspace[(k + 1) * tile + j]);
+					fma(fma(a, c + b - a, -b * c), one / fma(two, a, -b - c), a).store(&workspace[k * tile + j]);
+					b = a;
+				}
+			}
+		std::copy_n(&workspace[(order - 1) * tile], returned, result.begin() + lane);
+	}
+	return result;
+}
+
+/**
+* @brief Epsilon Algorithm for a batch of series
+* The lane j of the result is the Epsilon Algorithm applied to the series at the argument j, see epsilon_algorithm.
+* The partial sums are pushed into the two last diagonals of the epsilon table like in lozenge_table, but every entry is a row of lanes.
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class epsilon_algorithm_batch
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Epsilon Algorithm for the batch.
+   * @param batch The batch of series to be accelerated
+   */
+	epsilon_algorithm_batch(const series_batch<T, K>& batch);
+
+	/**
+   * @brief Computes the partial sums after the transformation for all the arguments of the batch.
+   * T_n of the order k is e_{2k}^{(n-1)}, it depends on the partial sums S_{n-1}, ..., S_{n-1+2k}.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation.
+   * @return The vector of batch.size() partial sums after the transformation.
+   */
+	std::vector<T> operator()(const K n, const int order) const;
+
+private:
+	/**
+   * @brief The batch whose convergence we accelerate
+   */
+	const series_batch<T, K>& batch;
+};
+
+template <typename T, typename K>
+epsilon_algorithm_batch<T, K>::epsilon_algorithm_batch(const series_batch<T, K>& batch) : batch(batch) {}
+
+template <typename T, typename K>
+std::vector<T> epsilon_algorithm_batch<T, K>::operator()(const K n, const int order) const
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	if (n < 0 || order < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<T> result(batch.size(), DEF_UNDEFINED_SUM);
+	if (n == 0)
+		return result;
+
+	const K last = std::max<K>(n - 1 + 2 * order, n); // the order 0 needs S_n
+	const std::size_t L = batch.lanes();
+	const std::size_t max_tile = std::min(L, series_batch<T, K>::tile_lanes);
+	std::vector<T> terms((last + 1) * max_tile);
+	std::vector<T> partial_sums(terms.size());
+	// two diagonals of the columns -1, 0, ..., 2 * order with the stride max_tile for every tile, so the column -1 is never written and stays 0
+	const std::size_t columns = 2 * order + 2;
+	std::vector<T> diagonals(2 * columns * max_tile, 0);
+	const auto one = pack::broadcast(1);
+	for (std::size_t lane = 0; lane < L; lane += max_tile)
+	{
+		const std::size_t tile = std::min(max_tile, L - lane);
+		const std::size_t returned = std::min(tile, result.size() - lane); // the padding lanes are not returned
+		batch.fill_terms_and_partial_sums(last, lane, tile, std::span<T>(terms).first((last + 1) * tile), std::span<T>(partial_sums).first((last + 1) * tile));
+		if (order == 0)
+		{
+			std::copy_n(&partial_sums[n * tile], returned, result.begin() + lane);
+			continue;
+		}
+
+		for (std::size_t t = 0; t <= 2 * static_cast<std::size_t>(order); ++t)
+		{
+			T* current = &diagonals[(t % 2) * columns * max_tile + max_tile];
+			const T* previous = &diagonals[((t + 1) % 2) * columns * max_tile + max_tile];
+			std::copy_n(&partial_sums[(n - 1 + t) * tile], tile, current);
+			for (std::size_t c = 1; c <= t; ++c)
+				for (std::size_t j = 0; j < tile; j += width)
+				{
+					const auto difference = pack::load(&current[(c - 1) * max_tile + j]) - pack::load(&previous[(c - 1) * max_tile + j]);
+					(pack::load(&previous[c * max_tile - 2 * max_tile + j]) + one / difference).store(&current[c * max_tile + j]);
+				}
+		}
+		std::copy_n(&diagonals[max_tile + 2 * order * max_tile], returned, result.begin() + lane); // the column 2 * order of the last diagonal t = 2 * order, which is even
+	}
+	return result;
+}
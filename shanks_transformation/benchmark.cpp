@@ -0,0 +1,146 @@
+/**
+ * @file benchmark.cpp
+ * @brief The benchmark of every series with every transformation over the grids of n, orders and types, see benchmark.h
+ * The options are given as --name=value, the lists are comma-separated and may contain the ranges, e.g. --series=1-5,20 --types=double,double_double.
+ * The report goes to the standard output or to --output as CSV or JSON. With --baseline=report.csv the medians are compared with the earlier CSV report,
+ * the jobs slower than the baseline by more than --threshold are listed on the standard error and the exit code is 1.
+ * With --perf=transform or --perf=terms the hardware counters of perf_counters.h are reported per term for the whole transformation
+ * or for the generation of its terms, the columns of the unavailable counters are left empty.
+ * With --mode=pareto the regular report is replaced by the Pareto frontiers of the digits -log10 |S - T| against the time and against the terms
+ * for every series and x: the CSV goes to --output or to pareto.csv and the summary table to the standard output.
+ * With --trace=trace.json the phases of the first call of every job are written as a Chrome trace, if the program is built with SHANKS_TRACING.
+ */
+#include "benchmark.h"
+#include <iostream>
+#include <fstream>
+
+/**
+* @brief Parses a comma-separated list of integers and ranges a-b
+* @param list The list
+* @return The integers
+*/
+static std::vector<long long> parse_integers(const std::string& list)
+{
+	std::vector<long long> values;
+	std::istringstream items(list);
+	for (std::string item; std::getline(items, item, ',');)
+	{
+		const auto dash = item.find('-', 1);
+		const long long first = std::stoll(item.substr(0, dash));
+		const long long last = dash == std::string::npos ? first : std::stoll(item.substr(dash + 1));
+		for (long long value = first; value <= last; ++value)
+			values.push_back(value);
+	}
+	return values;
+}
+
+static void print_usage()
+{
+	std::cout << "shanks_benchmark [--series=1-31] [--transformations=1-10] [--n=16,64] [--orders=2,4] [--types=double]\n"
+		"  [--x=0.5] [--alpha=0.5] [--b=1] [--m=1] [--warmup=2] [--repetitions=11] [--min-sample-ns=50000]\n"
+		"  [--format=csv|json] [--output=file] [--baseline=report.csv] [--threshold=0.1] [--perf=none|transform|terms] [--trace=file]\n"
+		"  [--mode=report|pareto]\n"
+		"The types are float, double, long_double and double_double" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+	try
+	{
+		std::map<std::string, std::string> arguments = {
+			{ "series", "1-31" }, { "transformations", "1-10" }, { "n", "16,64" }, { "orders", "2,4" }, { "types", "double" },
+			{ "x", "0.5" }, { "alpha", "0.5" }, { "b", "1" }, { "m", "1" }, { "warmup", "2" }, { "repetitions", "11" }, { "min-sample-ns", "50000" },
+			{ "format", "csv" }, { "output", "" }, { "baseline", "" }, { "threshold", "0.1" }, { "perf", "none" }, { "trace", "" }, { "mode", "report" }
+		};
+		for (int i = 1; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+			const auto equals = argument.find('=');
+			if (argument.rfind("--", 0) != 0 || equals == std::string::npos || !arguments.count(argument.substr(2, equals - 2)))
+			{
+				print_usage();
+				return argument == "--help" ? 0 : 2;
+			}
+			arguments[argument.substr(2, equals - 2)] = argument.substr(equals + 1);
+		}
+
+		std::vector<int> series_ids, transformation_ids, orders;
+		for (const auto id : parse_integers(arguments["series"]))
+			series_ids.push_back(static_cast<int>(id));
+		for (const auto id : parse_integers(arguments["transformations"]))
+			transformation_ids.push_back(static_cast<int>(id));
+		for (const auto order : parse_integers(arguments["orders"]))
+			orders.push_back(static_cast<int>(order));
+		std::vector<long long> ns = parse_integers(arguments["n"]);
+		std::vector<grid_type_id> types;
+		std::istringstream type_names(arguments["types"]);
+		for (std::string name; std::getline(type_names, name, ',');)
+			types.push_back(grid_type_from_name(name));
+
+		benchmark_options options;
+		options.warmup = std::stoi(arguments["warmup"]);
+		options.repetitions = std::stoi(arguments["repetitions"]);
+		options.min_sample_ns = std::stod(arguments["min-sample-ns"]);
+		const std::map<std::string, perf_region_t> perf_regions = { { "none", perf_region_none }, { "transform", perf_region_transform }, { "terms", perf_region_terms } };
+		if (!perf_regions.count(arguments["perf"]))
+			throw std::domain_error("wrong region of the counters " + arguments["perf"]);
+		options.perf_region = perf_regions.at(arguments["perf"]);
+		if (arguments["mode"] != "report" && arguments["mode"] != "pareto")
+			throw std::domain_error("wrong mode " + arguments["mode"]);
+		options.trace = !arguments["trace"].empty();
+		if (options.trace && !tracing_enabled)
+			std::cerr << "the program is built without SHANKS_TRACING, the trace is empty" << std::endl;
+		perf_probe probe;
+		if (options.perf_region != perf_region_none && !probe.unavailable_reason().empty())
+			std::cerr << "some hardware counters are unavailable, their columns are left empty (" << probe.unavailable_reason() << ")" << std::endl;
+
+		const auto jobs = make_grid<long long>(series_ids, { std::stold(arguments["x"]) }, ns, orders, transformation_ids, types,
+			std::stold(arguments["alpha"]), std::stoll(arguments["b"]), std::stoll(arguments["m"]));
+		std::vector<benchmark_record<long long>> records;
+		records.reserve(jobs.size());
+		for (const auto& job : jobs)
+			records.push_back(benchmark_job(job, options, &probe));
+
+		if (arguments["mode"] == "pareto")
+		{
+			const auto frontier = pareto_frontier(records);
+			std::ofstream pareto_file(arguments["output"].empty() ? "pareto.csv" : arguments["output"]);
+			write_pareto_csv(pareto_file, records, frontier);
+			write_pareto_summary(std::cout, records, frontier);
+		}
+		else
+		{
+			std::ofstream file;
+			if (!arguments["output"].empty())
+				file.open(arguments["output"]);
+			std::ostream& out = arguments["output"].empty() ? std::cout : file;
+			if (arguments["format"] == "json")
+				write_benchmark_json(out, records, options);
+			else
+				write_benchmark_csv(out, records, options);
+		}
+
+		if (options.trace && !write_trace_file(arguments["trace"]))
+			throw std::domain_error("cannot write the trace " + arguments["trace"]);
+
+		if (arguments["baseline"].empty())
+			return 0;
+		std::ifstream baseline_file(arguments["baseline"]);
+		if (!baseline_file)
+			throw std::domain_error("cannot open the baseline " + arguments["baseline"]);
+		const auto regressions = compare_with_baseline(records, read_benchmark_csv(baseline_file), std::stod(arguments["threshold"]));
+		for (const auto& regression : regressions)
+		{
+			const auto& [series_id, transformation_id, type, n, order] = regression.key;
+			std::cerr << "regression: series " << series_id << ", transformation " << transformation_id << ", " << type << ", n = " << n << ", order = " << order
+				<< ": " << regression.median_ns << " ns against " << regression.baseline_ns << " ns in the baseline" << std::endl;
+		}
+		return regressions.empty() ? 0 : 1;
+	}
+	catch (std::exception& e) // the wrong options
+	{
+		std::cerr << e.what() << std::endl;
+		print_usage();
+		return 2;
+	}
+}
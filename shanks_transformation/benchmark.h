@@ -0,0 +1,546 @@
+/**
+ * @file benchmark.h
+ * @brief This file contains the benchmark of the transformations: the timing with a monotonic clock, warmups and repetitions,
+ * the statistics of the samples, the reports in CSV and JSON and the comparison with a baseline report
+ */
+
+#pragma once
+#include <vector> // Include the vector library
+#include <string> // Include the string library
+#include <map> // Include the map library for the baseline
+#include <tuple> // Include the tuple library for the keys of the baseline
+#include <sstream> // Include the sstream library for parsing the CSV
+#include <ostream> // Include the ostream library
+#include <istream> // Include the istream library
+#include <chrono> // Include the chrono library for std::chrono::steady_clock
+#include <algorithm> // Include the algorithm library for std::sort
+#include <numeric> // Include the numeric library for std::accumulate
+#include <atomic> // Include the atomic library for std::atomic_signal_fence
+#include <stdexcept> // Include the stdexcept library for std::domain_error and std::overflow_error
+#include <cmath> // Include the cmath library for std::ceil and std::log10
+#include <iomanip> // Include the iomanip library for std::setw
+#include "grid_runner.h"
+#include "perf_counters.h"
+
+/**
+ * @brief The region of a job the hardware counters wrap, see perf_probe
+ */
+enum perf_region_t {
+	perf_region_none,
+	perf_region_transform, // the whole transformed partial sum
+	perf_region_terms // the generation of the terms it depends on, see series_acceleration::terms_required
+};
+
+/**
+ * @brief The settings of the measurements
+ */
+struct benchmark_options
+{
+	int warmup = 2; // the samples run and discarded before the measured ones
+	int repetitions = 11; // the measured samples
+	double min_sample_ns = 50000; // a sample repeats the call until it takes at least this long, so that it is far above the resolution of the clock
+	perf_region_t perf_region = perf_region_none;
+	bool trace = false; // record the spans of the first call of every job, see trace_events.h
+};
+
+/**
+ * @brief The statistics of the time of a call over the samples, in nanoseconds per call
+ */
+struct benchmark_statistics
+{
+	double median = 0;
+	double p95 = 0; // the nearest-rank 95th percentile
+	double min = 0;
+	double mean = 0;
+	std::size_t samples = 0;
+	std::size_t iterations = 0; // the calls per sample
+};
+
+/**
+ * @brief The measurement of a job of the grid
+ * @tparam K The type of enumerating integer
+ */
+template <typename K>
+struct benchmark_record
+{
+	grid_job<K> job;
+	eval_status status; // invalid_argument if the series or the transformation is not applicable, such jobs are not measured
+	benchmark_statistics time;
+	instrumentation_counters counters; // the work of one call, zero unless SHANKS_INSTRUMENTATION is defined
+	perf_sample events_per_term = perf_sample{}; // the hardware events of options.perf_region per term, NaN if not counted
+	double digits = std::numeric_limits<double>::quiet_NaN(); // -log10 |S - T|, the exact results get the precision of the type
+	std::uint64_t terms = 0; // the terms evaluated by a call if SHANKS_INSTRUMENTATION is defined, otherwise the terms the result depends on
+};
+
+/**
+* @brief Keeps the result of a measured call alive, so that the compiler does not remove the call.
+* The empty assembly statement reads the value and clobbers the memory, so it costs no store and no conversion
+* @tparam T The type of the result
+* @param value The result
+*/
+template <typename T>
+inline void benchmark_sink(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : : "r,m"(value) : "memory");
+#else
+	static const void* volatile escape;
+	escape = &value;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+* @brief Measures the time of a call with std::chrono::steady_clock.
+* The number of the calls per sample is doubled until a sample takes options.min_sample_ns, then options.warmup samples are discarded
+* and options.repetitions samples are measured.
+* @tparam F The type of the call, it returns a value convertible to double
+* @param f The call
+* @param options The settings of the measurements
+* @return The statistics of the time of a call
+*/
+template <typename F>
+benchmark_statistics measure(F&& f, const benchmark_options& options)
+{
+	using clock = std::chrono::steady_clock;
+	const auto sample = [&](const std::size_t iterations)
+	{
+		const auto start_time = clock::now();
+		for (std::size_t i = 0; i < iterations; ++i)
+			benchmark_sink(f());
+		return std::chrono::duration<double, std::nano>(clock::now() - start_time).count();
+	};
+
+	std::size_t iterations = 1;
+	while (sample(iterations) < options.min_sample_ns && iterations < (std::size_t(1) << 24))
+		iterations *= 2;
+	for (int w = 0; w < options.warmup; ++w)
+		sample(iterations);
+
+	std::vector<double> samples(std::max(options.repetitions, 1));
+	for (auto& s : samples)
+		s = sample(iterations) / static_cast<double>(iterations);
+	std::sort(samples.begin(), samples.end());
+
+	benchmark_statistics statistics;
+	const std::size_t size = samples.size();
+	statistics.median = size % 2 ? samples[size / 2] : (samples[size / 2 - 1] + samples[size / 2]) / 2;
+	statistics.p95 = samples[static_cast<std::size_t>(std::ceil(0.95 * static_cast<double>(size))) - 1];
+	statistics.min = samples.front();
+	statistics.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(size);
+	statistics.samples = size;
+	statistics.iterations = iterations;
+	return statistics;
+}
+
+/**
+* @brief Measures the transformed partial sum of the job in the type T.
+* The series and the transformation are created once, the call is series_acceleration::try_eval.
+* The partial sum cache of the series is off, so every call does the whole work.
+* If the probe is given, it counts the hardware events of options.perf_region over as many calls as a sample makes.
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @param job The job
+* @param options The settings of the measurements
+* @param probe The probe of the hardware counters or nullptr
+* @return The measurement
+*/
+template <typename T, typename K>
+benchmark_record<K> benchmark_job(const grid_job<K>& job, const benchmark_options& options, perf_probe* probe = nullptr)
+{
+	benchmark_record<K> record{};
+	record.job = job;
+	record.status = eval_status::invalid_argument;
+	record.events_per_term.fill(std::numeric_limits<double>::quiet_NaN());
+	std::unique_ptr<series_base<T, K>> series;
+	std::unique_ptr<series_acceleration<T, K, series_base<T, K>*>> transform;
+	try
+	{
+		series = make_series<T, K>(job.series_id, static_cast<T>(job.x), static_cast<T>(job.alpha), job.b, job.m);
+		transform = make_transformation<T, K>(job.transformation_id, series.get(), is_alternating_series(job.series_id));
+	}
+	catch (std::domain_error&) // the series or the transformation is not defined for the parameters
+	{
+		return record;
+	}
+	catch (std::overflow_error&) // the sum of the series is too big for T, e.g. m_fact_1mx_mp1_inverse_series
+	{
+		return record;
+	}
+	if (options.trace)
+		start_tracing();
+	eval_result<T> result;
+	record.counters = instrument([&] { result = transform->try_eval(job.n, job.order); });
+	if (options.trace)
+		stop_tracing();
+	record.status = result.status;
+	record.terms = instrumentation_enabled ? record.counters.terms : static_cast<std::uint64_t>(transform->terms_required(job.n, job.order));
+	if (result.status == eval_status::ok)
+	{
+		const T error = series_math::abs(series->get_sum() - result.value);
+		record.digits = error > 0 ? -std::log10(static_cast<double>(error)) : -std::log10(static_cast<double>(std::numeric_limits<T>::epsilon()));
+	}
+	record.time = measure([&] { return transform->try_eval(job.n, job.order).value; }, options);
+	if (!probe || !probe->available() || options.perf_region == perf_region_none)
+		return record;
+
+	const K terms = std::max<K>(transform->terms_required(job.n, job.order), 1);
+	std::vector<T> generated(static_cast<std::size_t>(terms));
+	const perf_sample events = probe->measure([&]
+	{
+		for (std::size_t i = 0; i < record.time.iterations; ++i)
+		{
+			if (options.perf_region == perf_region_terms)
+			{
+				series->fill_terms(0, generated);
+				benchmark_sink(generated.back());
+			}
+			else
+				benchmark_sink(transform->try_eval(job.n, job.order).value);
+		}
+	});
+	for (int event = 0; event < perf_event_count; ++event)
+		record.events_per_term[event] = events[event] / (static_cast<double>(terms) * static_cast<double>(record.time.iterations));
+	return record;
+}
+
+/**
+* @brief Measures the transformed partial sum of the job in its type
+* @tparam K The type of enumerating integer
+* @param job The job
+* @param options The settings of the measurements
+* @param probe The probe of the hardware counters or nullptr
+* @return The measurement
+*/
+template <typename K>
+benchmark_record<K> benchmark_job(const grid_job<K>& job, const benchmark_options& options, perf_probe* probe = nullptr)
+{
+	switch (job.type)
+	{
+	case grid_type_id::float_type:
+		return benchmark_job<float, K>(job, options, probe);
+	case grid_type_id::double_type:
+		return benchmark_job<double, K>(job, options, probe);
+	case grid_type_id::long_double_type:
+		return benchmark_job<long double, K>(job, options, probe);
+	case grid_type_id::double_double_type:
+		return benchmark_job<double_double, K>(job, options, probe);
+	default:
+		throw std::domain_error("wrong type of the job");
+	}
+}
+
+/**
+* @brief The name of the type of a job in the reports
+* @param type The type
+* @return The name: float, double, long_double or double_double
+*/
+inline std::string grid_type_name(const grid_type_id type)
+{
+	switch (type)
+	{
+	case grid_type_id::float_type:
+		return "float";
+	case grid_type_id::double_type:
+		return "double";
+	case grid_type_id::long_double_type:
+		return "long_double";
+	case grid_type_id::double_double_type:
+		return "double_double";
+	default:
+		throw std::domain_error("wrong type of the job");
+	}
+}
+
+/**
+* @brief The type of a job by its name in the reports
+* @param name The name, see grid_type_name
+* @return The type
+*/
+inline grid_type_id grid_type_from_name(const std::string& name)
+{
+	for (const auto type : { grid_type_id::float_type, grid_type_id::double_type, grid_type_id::long_double_type, grid_type_id::double_double_type })
+		if (grid_type_name(type) == name)
+			return type;
+	throw std::domain_error("wrong type name " + name);
+}
+
+/**
+* @brief The name of the status of a measurement in the reports
+* @param status The status
+* @return The name: ok, non_finite, overflow, failure or not_applicable
+*/
+inline std::string benchmark_status_name(const eval_status status)
+{
+	switch (status)
+	{
+	case eval_status::ok:
+		return "ok";
+	case eval_status::non_finite:
+		return "non_finite";
+	case eval_status::overflow:
+		return "overflow";
+	case eval_status::failure:
+		return "failure";
+	default:
+		return "not_applicable";
+	}
+}
+
+/**
+* @brief Writes the measurements as CSV, one line per job, with the counters of the work of one call if SHANKS_INSTRUMENTATION is defined
+* and the hardware events per term if options.perf_region is set, the events that were not counted are left empty
+* @tparam K The type of enumerating integer
+* @param out The stream
+* @param records The measurements
+* @param options The settings of the measurements
+*/
+template <typename K>
+void write_benchmark_csv(std::ostream& out, const std::vector<benchmark_record<K>>& records, const benchmark_options& options)
+{
+	out << "series,transformation,type,n,order,x,status,median_ns,p95_ns,min_ns,mean_ns,samples,iterations,evaluations_per_second"
+		<< (instrumentation_enabled ? ",terms,partial_sums,divisions,table_cells,scratch_bytes" : "");
+	if (options.perf_region != perf_region_none)
+	{
+		for (const auto name : perf_event_names)
+			out << ',' << name << "_per_term";
+	}
+	out << '\n';
+	for (const auto& record : records)
+	{
+		const auto& job = record.job;
+		const auto& time = record.time;
+		out << job.series_id << ',' << job.transformation_id << ',' << grid_type_name(job.type) << ',' << job.n << ',' << job.order << ',' << static_cast<double>(job.x) << ','
+			<< benchmark_status_name(record.status) << ',' << time.median << ',' << time.p95 << ',' << time.min << ',' << time.mean << ','
+			<< time.samples << ',' << time.iterations << ',' << (time.median > 0 ? 1e9 / time.median : 0);
+		const auto& counters = record.counters;
+		if (instrumentation_enabled)
+			out << ',' << counters.terms << ',' << counters.partial_sums << ',' << counters.divisions << ',' << counters.table_cells << ',' << counters.scratch_bytes;
+		if (options.perf_region != perf_region_none)
+		{
+			for (const double events : record.events_per_term)
+			{
+				if (std::isnan(events))
+					out << ',';
+				else
+					out << ',' << events;
+			}
+		}
+		out << '\n';
+	}
+}
+
+/**
+* @brief Writes the measurements as JSON: the settings and the array of the jobs, see write_benchmark_csv
+* @tparam K The type of enumerating integer
+* @param out The stream
+* @param records The measurements
+* @param options The settings of the measurements
+*/
+template <typename K>
+void write_benchmark_json(std::ostream& out, const std::vector<benchmark_record<K>>& records, const benchmark_options& options)
+{
+	out << "{\n  \"clock\": \"steady_clock\",\n  \"warmup\": " << options.warmup << ",\n  \"repetitions\": " << options.repetitions
+		<< ",\n  \"min_sample_ns\": " << options.min_sample_ns << ",\n  \"results\": [";
+	for (std::size_t i = 0; i < records.size(); ++i)
+	{
+		const auto& job = records[i].job;
+		const auto& time = records[i].time;
+		out << (i ? ",\n" : "\n") << "    { \"series\": " << job.series_id << ", \"transformation\": " << job.transformation_id
+			<< ", \"type\": \"" << grid_type_name(job.type) << "\", \"n\": " << job.n << ", \"order\": " << job.order << ", \"x\": " << static_cast<double>(job.x)
+			<< ", \"status\": \"" << benchmark_status_name(records[i].status) << "\", \"median_ns\": " << time.median << ", \"p95_ns\": " << time.p95
+			<< ", \"min_ns\": " << time.min << ", \"mean_ns\": " << time.mean << ", \"samples\": " << time.samples << ", \"iterations\": " << time.iterations
+			<< ", \"evaluations_per_second\": " << (time.median > 0 ? 1e9 / time.median : 0);
+		const auto& counters = records[i].counters;
+		if (instrumentation_enabled)
+			out << ", \"terms\": " << counters.terms << ", \"partial_sums\": " << counters.partial_sums << ", \"divisions\": " << counters.divisions
+				<< ", \"table_cells\": " << counters.table_cells << ", \"scratch_bytes\": " << counters.scratch_bytes;
+		if (options.perf_region != perf_region_none)
+		{
+			for (int event = 0; event < perf_event_count; ++event)
+			{
+				out << ", \"" << perf_event_names[event] << "_per_term\": ";
+				if (std::isnan(records[i].events_per_term[event]))
+					out << "null";
+				else
+					out << records[i].events_per_term[event];
+			}
+		}
+		out << " }";
+	}
+	out << "\n  ]\n}\n";
+}
+
+/**
+ * @brief The key of a job in a baseline: the series, the transformation, the type, n and the order
+ */
+using benchmark_key = std::tuple<int, int, std::string, long long, int>;
+
+/**
+* @brief Reads the median times of the measured jobs from a report written by write_benchmark_csv
+* @param in The stream
+* @return The median time in nanoseconds for every measured job
+*/
+inline std::map<benchmark_key, double> read_benchmark_csv(std::istream& in)
+{
+	std::map<benchmark_key, double> medians;
+	std::string line;
+	std::getline(in, line); // the header
+	while (std::getline(in, line))
+	{
+		std::istringstream fields(line);
+		std::vector<std::string> field;
+		for (std::string value; std::getline(fields, value, ',');)
+			field.push_back(value);
+		if (field.size() < 8 || field[6] == "not_applicable")
+			continue;
+		medians[{ std::stoi(field[0]), std::stoi(field[1]), field[2], std::stoll(field[3]), std::stoi(field[4]) }] = std::stod(field[7]);
+	}
+	return medians;
+}
+
+/**
+ * @brief A job whose throughput fell below the baseline
+ */
+struct benchmark_regression
+{
+	benchmark_key key;
+	double baseline_ns;
+	double median_ns;
+};
+
+/**
+* @brief Compares the measurements with the baseline
+* @tparam K The type of enumerating integer
+* @param records The measurements
+* @param baseline The median times of the baseline, see read_benchmark_csv
+* @param threshold The allowed relative slowdown, e.g. 0.1 for 10%
+* @return The jobs whose median time exceeds the baseline by more than the threshold
+*/
+template <typename K>
+std::vector<benchmark_regression> compare_with_baseline(const std::vector<benchmark_record<K>>& records, const std::map<benchmark_key, double>& baseline, const double threshold)
+{
+	std::vector<benchmark_regression> regressions;
+	for (const auto& record : records)
+	{
+		if (record.status == eval_status::invalid_argument)
+			continue;
+		const auto& job = record.job;
+		const benchmark_key key = { job.series_id, job.transformation_id, grid_type_name(job.type), static_cast<long long>(job.n), job.order };
+		const auto found = baseline.find(key);
+		if (found != baseline.end() && record.time.median > found->second * (1 + threshold))
+			regressions.push_back({ key, found->second, record.time.median });
+	}
+	return regressions;
+}
+
+/**
+ * @brief A job on the Pareto frontier of the accuracy against the cost
+ */
+struct pareto_point
+{
+	std::size_t record; // the index of the measurement
+	bool time_frontier; // no other job of the series and x gives as many digits in less time
+	bool terms_frontier; // no other job of the series and x gives as many digits with fewer terms
+};
+
+/**
+* @brief Finds the Pareto frontiers of the digits against the median time and against the terms, separately for every series and x.
+* The type, the transformation, the order and n are all the parts of the configuration, the jobs without a finite result are skipped.
+* @tparam K The type of enumerating integer
+* @param records The measurements
+* @return The jobs on either of the frontiers, by the series, x and the time
+*/
+template <typename K>
+std::vector<pareto_point> pareto_frontier(const std::vector<benchmark_record<K>>& records)
+{
+	std::map<std::pair<int, long double>, std::vector<std::size_t>> groups;
+	for (std::size_t i = 0; i < records.size(); ++i)
+		if (records[i].status == eval_status::ok && std::isfinite(records[i].digits))
+			groups[{ records[i].job.series_id, records[i].job.x }].push_back(i);
+
+	std::vector<pareto_point> frontier;
+	for (auto& [group, indices] : groups)
+	{
+		// a job is on the frontier of a cost if it gives more digits than all the cheaper ones, the ties in the cost go by the digits
+		const auto mark = [&](const auto& cost)
+		{
+			std::vector<bool> marked(indices.size());
+			std::vector<std::size_t> order(indices.size());
+			std::iota(order.begin(), order.end(), 0);
+			std::sort(order.begin(), order.end(), [&](const std::size_t a, const std::size_t b)
+			{
+				const auto& x = records[indices[a]];
+				const auto& y = records[indices[b]];
+				return cost(x) < cost(y) || (cost(x) == cost(y) && x.digits > y.digits);
+			});
+			double best = -std::numeric_limits<double>::infinity();
+			for (const std::size_t i : order)
+				if (records[indices[i]].digits > best)
+				{
+					best = records[indices[i]].digits;
+					marked[i] = true;
+				}
+			return marked;
+		};
+		const auto by_time = mark([](const benchmark_record<K>& record) { return record.time.median; });
+		const auto by_terms = mark([](const benchmark_record<K>& record) { return static_cast<double>(record.terms); });
+		const std::size_t first = frontier.size();
+		for (std::size_t i = 0; i < indices.size(); ++i)
+			if (by_time[i] || by_terms[i])
+				frontier.push_back({ indices[i], by_time[i], by_terms[i] });
+		std::sort(frontier.begin() + first, frontier.end(), [&](const pareto_point& a, const pareto_point& b)
+		{
+			return records[a.record].time.median < records[b.record].time.median;
+		});
+	}
+	return frontier;
+}
+
+/**
+* @brief Writes the Pareto frontiers as CSV, one line per job
+* @tparam K The type of enumerating integer
+* @param out The stream
+* @param records The measurements
+* @param frontier The jobs on the frontiers, see pareto_frontier
+*/
+template <typename K>
+void write_pareto_csv(std::ostream& out, const std::vector<benchmark_record<K>>& records, const std::vector<pareto_point>& frontier)
+{
+	out << "series,x,transformation,order,type,n,digits,terms,median_ns,time_frontier,terms_frontier\n";
+	for (const auto& point : frontier)
+	{
+		const auto& record = records[point.record];
+		const auto& job = record.job;
+		out << job.series_id << ',' << static_cast<double>(job.x) << ',' << job.transformation_id << ',' << job.order << ',' << grid_type_name(job.type) << ','
+			<< job.n << ',' << record.digits << ',' << record.terms << ',' << record.time.median << ',' << point.time_frontier << ',' << point.terms_frontier << '\n';
+	}
+}
+
+/**
+* @brief Writes the Pareto frontiers as a plain text table, a block per series and x, the jobs by the time
+* @tparam K The type of enumerating integer
+* @param out The stream
+* @param records The measurements
+* @param frontier The jobs on the frontiers, see pareto_frontier
+*/
+template <typename K>
+void write_pareto_summary(std::ostream& out, const std::vector<benchmark_record<K>>& records, const std::vector<pareto_point>& frontier)
+{
+	const auto flags = out.flags();
+	const auto precision = out.precision();
+	out << std::fixed << std::setprecision(1);
+	for (std::size_t i = 0; i < frontier.size(); ++i)
+	{
+		const auto& record = records[frontier[i].record];
+		const auto& job = record.job;
+		if (i == 0 || job.series_id != records[frontier[i - 1].record].job.series_id || job.x != records[frontier[i - 1].record].job.x)
+			out << (i ? "\n" : "") << "series " << job.series_id << ", x = " << static_cast<double>(job.x) << '\n'
+				<< std::setw(15) << "transformation" << std::setw(7) << "order" << std::setw(15) << "type" << std::setw(8) << "n"
+				<< std::setw(8) << "digits" << std::setw(10) << "terms" << std::setw(14) << "median ns" << "  frontier\n";
+		out << std::setw(15) << job.transformation_id << std::setw(7) << job.order << std::setw(15) << grid_type_name(job.type) << std::setw(8) << job.n
+			<< std::setw(8) << record.digits << std::setw(10) << record.terms << std::setw(14) << record.time.median << "  "
+			<< (frontier[i].time_frontier ? (frontier[i].terms_frontier ? "time, terms" : "time") : "terms") << '\n';
+	}
+	out.flags(flags);
+	out.precision(precision);
+}
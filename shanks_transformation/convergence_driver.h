@@ -0,0 +1,140 @@
+/**
+ * @file convergence_driver.h
+ * @brief This file contains the driver that sums the series up to the requested tolerance
+ */
+
+#pragma once
+#include <vector>  // Include the vector library
+#include <cmath>   // Include the cmath library for std::abs and std::isfinite
+#include <limits>  // Include the limits library for the infinity
+#include <algorithm> // Include the algorithm library for std::min and std::max
+#include <type_traits> // Include the type_traits library for std::type_identity_t
+#include "series_acceleration.h"
+
+/**
+ * @brief The result of sum_until_converged
+ * @tparam T The type of the elements in the series, K The type of enumerating integer
+ */
+template <typename T, typename K>
+struct convergence_result
+{
+	/**
+   * @brief The accelerated sum
+   */
+	T value = 0;
+
+	/**
+   * @brief The larger of the last two differences between the successive accelerated estimates
+   */
+	T error_estimate = std::numeric_limits<T>::infinity();
+
+	/**
+   * @brief The number of terms the returned value depends on
+   */
+	K terms_used = 0;
+
+	/**
+   * @brief The number of terms evaluated by the driver over all the rounds, counted by the instrumentation if SHANKS_INSTRUMENTATION is defined
+   * and estimated by series_acceleration::terms_required of the last round otherwise, as the rounds share the cached terms
+   */
+	std::size_t work = 0;
+
+	/**
+   * @brief Whether the tolerance was reached, otherwise the result is the most stable estimate found
+   */
+	bool converged = false;
+};
+
+/**
+ * @brief The stability of the estimate c after a and b, it is max(|c - b|, |b - a|)
+ * @tparam T The type of the estimates
+ * @return The larger of the two differences or infinity if any of the estimates is not finite
+ */
+template <typename T>
+inline T stability_error(const T a, const T b, const T c)
+{
+	if (!series_math::isfinite(a) || !series_math::isfinite(b) || !series_math::isfinite(c))
+		return std::numeric_limits<T>::infinity();
+	return std::max(series_math::abs(c - b), series_math::abs(b - a));
+}
+
+/**
+ * @brief The rounds of sum_until_converged, it is called with the term cache of the transformation on
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ * @return The accelerated sum, see sum_until_converged
+ */
+template <typename T, typename K, typename series_templ>
+convergence_result<T, K> convergence_rounds(const series_acceleration<T, K, series_templ>& transformation, const T tolerance, const int order,
+	const K max_N, const K initial_N)
+{
+	convergence_result<T, K> result;
+	K checked = std::max<K>(order + 2, 2); // the transformed partial sums of the order are defined for n > order
+	std::size_t cached_terms = 0; // the terms evaluated by the earlier rounds
+	for (K N = initial_N;; N = static_cast<K>(std::min<std::size_t>(2 * static_cast<std::size_t>(N), max_N)))
+	{
+		std::vector<T> transformed; // transformed[n - 1] is T_n
+		const auto counters = instrument([&] { transformed = transformation.sweep(N, order); });
+		const std::size_t terms = std::max(cached_terms, static_cast<std::size_t>(transformation.terms_required(N, order)));
+		result.work += instrumentation_enabled ? static_cast<std::size_t>(counters.terms) : terms - cached_terms;
+		cached_terms = terms;
+		for (K n = checked + 1; n <= N; ++n)
+		{
+			const T estimate = transformed[n - 1];
+			const T error = stability_error(transformed[n - 3], transformed[n - 2], estimate);
+			const bool converged = series_math::isfinite(error) && error <= tolerance * std::max<T>(1, series_math::abs(estimate));
+			if (converged || error < result.error_estimate)
+			{
+				result.value = estimate;
+				result.error_estimate = error;
+				result.terms_used = transformation.terms_required(n, order);
+				result.converged = converged;
+			}
+			if (converged)
+				return result;
+		}
+		checked = std::max(checked, N);
+		if (N == max_N)
+			return result;
+	}
+}
+
+/**
+ * @brief Sums the series up to the tolerance
+ * Computes the transformed partial sums T_1, ..., T_N with sweep and stops at the first n for which
+ * the successive estimates T_{n-2}, T_{n-1}, T_n agree within tolerance * max(1, |T_n|).
+ * N starts from initial_N and doubles until the estimates agree or N reaches max_N. The term cache of the transformation is on during the rounds
+ * (see series_acceleration::enable_term_cache), so every term of the series is evaluated once over all the rounds, also by the transformations
+ * that use the default sweep and compute every T_n separately (Levin, Richardson). The tables are rebuilt in every round,
+ * which is at most twice the table work of the last sweep. The table work of CVZ is O(N * min(N, max_terms)) as every T_n has its own weights.
+ * The state of the term cache is restored on return.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ * @param transformation The transformation used to accelerate the series
+ * @param tolerance The requested tolerance, it must be positive
+ * @param order The order of the transformation
+ * @param max_N The largest number of terms of the transformed partial sum
+ * @param initial_N The number of terms of the transformed partial sum in the first round
+ * @return The accelerated sum, if the tolerance is not reached it is the most stable estimate found
+ */
+template <typename T, typename K, typename series_templ>
+convergence_result<T, K> sum_until_converged(series_acceleration<T, K, series_templ>& transformation, const T tolerance, const int order,
+	const std::type_identity_t<K> max_N = 4096, const std::type_identity_t<K> initial_N = 16)
+{
+	if (!(tolerance > 0))
+		throw std::domain_error("the tolerance must be positive");
+	if (order < 0 || initial_N < 1 || max_N < initial_N)
+		throw std::domain_error("negative integer in the input");
+
+	const bool term_cache_enabled = transformation.is_term_cache_enabled();
+	transformation.enable_term_cache(); // the rounds reuse the terms and the partial sums of the earlier ones
+	try
+	{
+		const auto result = convergence_rounds(transformation, tolerance, order, max_N, initial_N);
+		transformation.enable_term_cache(term_cache_enabled);
+		return result;
+	}
+	catch (...)
+	{
+		transformation.enable_term_cache(term_cache_enabled);
+		throw;
+	}
+}
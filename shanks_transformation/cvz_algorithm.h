@@ -0,0 +1,178 @@
+/**
+ * @file cvz_algorithm.h
+ * @brief This file contains the declaration of the Cohen-Villegas-Zagier algorithm class.
+ */
+
+#pragma once
+
+#include "series_acceleration.h" // Include the series header
+#include <algorithm> // Include the algorithm library for std::min
+#include <vector> // Include the vector library
+
+/**
+ * @brief Cohen-Villegas-Zagier algorithm class template.
+ * Accelerates the alternating series sum (-1)^k a_k by weighting the terms with the coefficients of the shifted Chebyshev polynomial:
+ * S = (c_0 a_0 - c_1 a_1 + ... ) / d, see Algorithm 1 in [H. Cohen, F. Rodriguez Villegas, D. Zagier, Convergence acceleration of alternating series].
+ * The error bound (3 + sqrt(8))^{-N} ~ 5.8^{-N} relative to the sum, where N is the number of terms, holds only if the magnitudes |a_k| are
+ * totally monotone, i.e. the moments a_k = integral of x^k over a positive measure on [0, 1], e.g. 1 / (2k + 1) of pi_4_series.
+ * The other series get no bound, e.g. ln2_series starts with a_0 = 0, so its magnitudes are not monotone, although in practice it converges at about the same rate.
+ * T_n uses O(n) operations, O(1) memory apart from the terms and never divides by a difference of the partial sums.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class cvz_algorithm : public series_acceleration<T, K, series_templ>
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Cohen-Villegas-Zagier algorithm.
+   * @param series The series class object to be accelerated
+   */
+	cvz_algorithm(const series_templ& series);
+
+	/**
+   * @brief Cohen-Villegas-Zagier algorithm.
+   * Computes the weighted sum of the terms a_0, ..., a_n. The weights depend only on n, so every nonzero order gives the same result.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation, 0 means no transformation.
+   * @return The partial sum after the transformation.
+   */
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N
+   * The terms are computed once and shared between all n, but the weights depend on n, so every T_n is a separate weighted sum
+   * and the sweep uses O(N * min(N, max_terms)) operations and O(N) memory.
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The vector of T_1, ..., T_N
+   */
+	std::vector<T> sweep(const K N, const int order) const override;
+
+	/**
+   * @brief The number of the terms a_0, a_1, ... the transformed partial sum T_n of the given order depends on
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	K terms_required(const K n, const int order) const override;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order), the terms are evaluated once for all n
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	std::size_t sweep_terms_required(const K N, const int order) const override;
+
+	/**
+   * @brief The rough number of the arithmetic operations spent on the transformed partial sum T_n of the given order, apart from computing the terms
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of operations
+   */
+	std::size_t operations_required(const K n, const int order) const override;
+
+private:
+	/**
+   * @brief The largest number of terms the weights are computed for.
+   * d = (3 + sqrt(8))^N must not overflow T, the earlier terms are summed up directly.
+   */
+	static K max_terms();
+
+	/**
+   * @brief Computes the weighted sum of the given amount of terms.
+   * @param count The number of terms
+   * @param term The function returning the kth of the terms
+   */
+	template <typename term_getter>
+	static T weighted_sum(const K count, const term_getter& term);
+};
+
+template <typename T, typename K, typename series_templ>
+cvz_algorithm<T, K, series_templ>::cvz_algorithm(const series_templ& series) : series_acceleration<T, K, series_templ>(series) {}
+
+template <typename T, typename K, typename series_templ>
+K cvz_algorithm<T, K, series_templ>::max_terms()
+{
+	return static_cast<K>(0.9 * std::numeric_limits<T>::max_exponent10 / series_math::log10(3 + series_math::sqrt(T(8))));
+}
+
+template <typename T, typename K, typename series_templ>
+template <typename term_getter>
+T cvz_algorithm<T, K, series_templ>::weighted_sum(const K count, const term_getter& term)
+{
+	SHANKS_TRACE_SPAN("cvz weighted sum");
+	SHANKS_COUNT(divisions, count + 2);
+	T d = series_math::pow(3 + series_math::sqrt(T(8)), count);
+	d = (d + 1 / d) / 2;
+	T b = -1;
+	T c = -d;
+	T s = 0;
+	T sign = 1;
+	for (K k = 0; k < count; ++k)
+	{
+		c = b - c;
+		s += c * sign * term(k);
+		b = (static_cast<T>(k) + count) * (static_cast<T>(k) - count) * b / ((k + T(0.5)) * (k + 1));
+		sign = -sign;
+	}
+	return s / d;
+}
+
+template <typename T, typename K, typename series_templ>
+T cvz_algorithm<T, K, series_templ>::evaluate(const K n, const int order) const
+{
+	if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
+		return this->S_n(n);
+	else if (n == 0)
+		return DEF_UNDEFINED_SUM;
+
+	const K count = std::min<K>(n + 1, max_terms());
+	const K first = n + 1 - count;
+	const T head = first > 0 ? this->S_n(first - 1) : 0;
+	return head + weighted_sum(count, [&](const K k) { return this->term(first + k); });
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<T> cvz_algorithm<T, K, series_templ>::sweep(const K N, const int order) const
+{
+	if (N < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<T> terms(N + 1);
+	std::vector<T> partial_sums(N + 1);
+	SHANKS_COUNT(scratch_bytes, (3 * N + 2) * sizeof(T)); // with the result
+	this->fill_terms_and_partial_sums(0, terms, partial_sums);
+
+	std::vector<T> result(N);
+	for (K n = 1; n <= N; ++n)
+	{
+		if (order == 0)
+		{
+			result[n - 1] = partial_sums[n];
+			continue;
+		}
+		const K count = std::min<K>(n + 1, max_terms());
+		const K first = n + 1 - count;
+		const T head = first > 0 ? partial_sums[first - 1] : 0;
+		result[n - 1] = head + weighted_sum(count, [&](const K k) { return terms[first + k]; });
+	}
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+K cvz_algorithm<T, K, series_templ>::terms_required(const K n, const int) const
+{
+	return n + 1;
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t cvz_algorithm<T, K, series_templ>::sweep_terms_required(const K N, const int order) const
+{
+	return static_cast<std::size_t>(terms_required(N, order));
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t cvz_algorithm<T, K, series_templ>::operations_required(const K n, const int order) const
+{
+	return order == 0 ? 0 : 8 * static_cast<std::size_t>(n + 1);
+}
@@ -0,0 +1,899 @@
+/**
+ * @file double_double.h
+ * @brief This file contains the double-double type, the unevaluated sum hi + lo of two doubles with |lo| <= ulp(hi) / 2, which carries about 32 significant digits
+ * The arithmetic is built on the error-free transformations two_sum and two_prod (the latter is a single fma), so it runs on the double units of the CPU
+ * and, unlike long double, can be vectorized: simd_pack<double_double> keeps the high and the low parts of the lanes in two double registers.
+ * The overloads of the <cmath> functions used by series.h make double_double a drop-in T of the series and the transformations.
+ * The kernels stay exact when the compiler contracts a * b + c into fma (GCC does it across statements by default): the product of two_prod
+ * is also used by an fma, so it is never fused, and fusing the products of the low parts only removes a rounding from the correction term.
+ * For more information, see [Y. Hida, X.S. Li, D.H. Bailey, Library for double-double and quad-double arithmetic, 2007]
+ */
+
+#pragma once
+#include <cmath>   // Include the cmath library for std::fma and the double versions of the functions
+#include <limits>  // Include the limits library for std::numeric_limits
+#include <numbers> // Include the numbers library for std::numbers::pi_v
+#include <compare> // Include the compare library for std::partial_ordering
+#include <type_traits> // Include the type_traits library for std::is_arithmetic_v
+#include <array>   // Include the array library
+#include <string>  // Include the string library
+#include <istream> // Include the istream library for operator>>
+#include <ostream> // Include the ostream library for operator<<
+#include <sstream> // Include the sstream library for std::to_string
+#include "simd_kernels.h"
+
+/**
+* @brief Error-free sum, s + e = a + b exactly where s = fl(a + b)
+* @tparam V The type of the limbs, double or simd_pack<double>
+*/
+template <typename V>
+constexpr void two_sum(const V a, const V b, V& s, V& e)
+{
+	s = a + b;
+	const V b_virtual = s - a;
+	e = (a - (s - b_virtual)) + (b - b_virtual);
+}
+
+/**
+* @brief Error-free sum for |a| >= |b|, it takes three operations instead of six
+* @tparam V The type of the limbs, double or simd_pack<double>
+*/
+template <typename V>
+constexpr void quick_two_sum(const V a, const V b, V& s, V& e)
+{
+	s = a + b;
+	e = b - (s - a);
+}
+
+/**
+* @brief Error-free product, p + e = a * b exactly where p = fl(a * b), the error is recovered by a single fma
+* @tparam V The type of the limbs, double or simd_pack<double>
+*/
+template <typename V>
+inline void two_prod(const V a, const V b, V& p, V& e)
+{
+	using std::fma;
+	p = a * b;
+	e = fma(a, b, -p); // this use keeps the compiler from fusing p into the sums that follow, so p stays the rounded product (see simd_pack::operator-)
+}
+
+/**
+* @brief The double-double kernels shared by double_double and simd_pack<double_double>
+* D is a pair { hi, lo } of limbs of the type V, the sums keep the error of both limbs (the "accurate" versions of the cited paper),
+* because the transformations subtract close partial sums.
+*/
+template <typename D>
+constexpr D dd_add(const D& a, const D& b)
+{
+	using V = decltype(D::hi);
+	V s1, s2, t1, t2;
+	two_sum(a.hi, b.hi, s1, s2);
+	two_sum(a.lo, b.lo, t1, t2);
+	s2 = s2 + t1;
+	quick_two_sum(s1, s2, s1, s2);
+	s2 = s2 + t2;
+	quick_two_sum(s1, s2, s1, s2);
+	return D{ s1, s2 };
+}
+
+template <typename D, typename V>
+constexpr D dd_add_limb(const D& a, const V b)
+{
+	V s1, s2;
+	two_sum(a.hi, b, s1, s2);
+	s2 = s2 + a.lo;
+	quick_two_sum(s1, s2, s1, s2);
+	return D{ s1, s2 };
+}
+
+template <typename D>
+constexpr D dd_sub(const D& a, const D& b)
+{
+	return dd_add(a, D{ -b.hi, -b.lo });
+}
+
+template <typename D>
+inline D dd_mul(const D& a, const D& b)
+{
+	using V = decltype(D::hi);
+	V p1, p2;
+	two_prod(a.hi, b.hi, p1, p2);
+	p2 = p2 + (a.hi * b.lo + a.lo * b.hi);
+	quick_two_sum(p1, p2, p1, p2);
+	return D{ p1, p2 };
+}
+
+template <typename D, typename V>
+inline D dd_mul_limb(const D& a, const V b)
+{
+	V p1, p2;
+	two_prod(a.hi, b, p1, p2);
+	p2 = p2 + a.lo * b;
+	quick_two_sum(p1, p2, p1, p2);
+	return D{ p1, p2 };
+}
+
+template <typename D>
+inline D dd_div(const D& a, const D& b)
+{
+	using V = decltype(D::hi);
+	// long division, every quotient digit q_i = r.hi / b.hi takes the next 53 bits
+	const V q1 = a.hi / b.hi;
+	D r = dd_sub(a, dd_mul_limb(b, q1));
+	V q2 = r.hi / b.hi;
+	r = dd_sub(r, dd_mul_limb(b, q2));
+	const V q3 = r.hi / b.hi;
+	V s, e;
+	quick_two_sum(q1, q2, s, e);
+	return dd_add_limb(D{ s, e }, q3);
+}
+
+/**
+* @brief Double-double number, the value is hi + lo
+* It is a pair of doubles without padding, so the arrays of double_double are arrays of doubles and the values are passed in registers.
+* The integers and the floating point numbers convert to double_double implicitly and exactly (the 64-bit integers as well), the opposite conversions are explicit.
+*/
+struct double_double
+{
+	/**
+   * @brief The leading part, it is the value rounded to double
+   */
+	double hi;
+
+	/**
+   * @brief The trailing part, |lo| <= ulp(hi) / 2
+   */
+	double lo;
+
+	double_double() = default;
+
+	/**
+   * @brief Makes the number from the already normalized limbs, |lo| <= ulp(hi) / 2
+   * @param hi The leading part
+   * @param lo The trailing part
+   */
+	constexpr double_double(const double hi, const double lo) : hi(hi), lo(lo) {}
+
+	/**
+   * @brief Exact conversion from an integer or a floating point number
+   * @tparam A The arithmetic type of the value
+   * @param a The value
+   */
+	template <typename A> requires std::is_arithmetic_v<A>
+	constexpr double_double(const A a);
+
+	/**
+   * @brief Conversion to an integer (truncating towards zero, like the built-in types) or to a floating point number (rounding)
+   * @tparam A The arithmetic type of the result
+   */
+	template <typename A> requires std::is_arithmetic_v<A>
+	explicit constexpr operator A() const;
+
+	double_double& operator+=(const double_double& b);
+	double_double& operator-=(const double_double& b);
+	double_double& operator*=(const double_double& b);
+	double_double& operator/=(const double_double& b);
+};
+
+static_assert(sizeof(double_double) == 2 * sizeof(double));
+
+template <typename A> requires std::is_arithmetic_v<A>
+constexpr double_double::double_double(const A a) : hi(0), lo(0)
+{
+	if constexpr (std::is_integral_v<A> && sizeof(A) > 4)
+	{
+		// both halves have at most 32 significant bits, so they are exact doubles
+		const A high = a / (A(1) << 32) * (A(1) << 32);
+		two_sum(static_cast<double>(high), static_cast<double>(a - high), hi, lo);
+	}
+	else if constexpr (std::is_floating_point_v<A> && sizeof(A) > sizeof(double))
+	{
+		hi = static_cast<double>(a);
+		lo = static_cast<double>(a - static_cast<A>(hi));
+	}
+	else
+		hi = static_cast<double>(a);
+}
+
+inline double_double operator-(const double_double& a)
+{
+	return { -a.hi, -a.lo };
+}
+
+inline double_double operator+(const double_double& a, const double_double& b)
+{
+	return dd_add(a, b);
+}
+
+inline double_double operator+(const double_double& a, const double b)
+{
+	return dd_add_limb(a, b);
+}
+
+inline double_double operator+(const double a, const double_double& b)
+{
+	return dd_add_limb(b, a);
+}
+
+inline double_double operator-(const double_double& a, const double_double& b)
+{
+	return dd_sub(a, b);
+}
+
+inline double_double operator-(const double_double& a, const double b)
+{
+	return dd_add_limb(a, -b);
+}
+
+inline double_double operator-(const double a, const double_double& b)
+{
+	return dd_add_limb(-b, a);
+}
+
+inline double_double operator*(const double_double& a, const double_double& b)
+{
+	return dd_mul(a, b);
+}
+
+inline double_double operator*(const double_double& a, const double b)
+{
+	return dd_mul_limb(a, b);
+}
+
+inline double_double operator*(const double a, const double_double& b)
+{
+	return dd_mul_limb(b, a);
+}
+
+inline double_double operator/(const double_double& a, const double_double& b)
+{
+	return dd_div(a, b);
+}
+
+inline double_double operator/(const double_double& a, const double b)
+{
+	return dd_div(a, double_double(b));
+}
+
+inline double_double operator/(const double a, const double_double& b)
+{
+	return dd_div(double_double(a), b);
+}
+
+inline double_double& double_double::operator+=(const double_double& b)
+{
+	return *this = *this + b;
+}
+
+inline double_double& double_double::operator-=(const double_double& b)
+{
+	return *this = *this - b;
+}
+
+inline double_double& double_double::operator*=(const double_double& b)
+{
+	return *this = *this * b;
+}
+
+inline double_double& double_double::operator/=(const double_double& b)
+{
+	return *this = *this / b;
+}
+
+constexpr bool operator==(const double_double& a, const double_double& b)
+{
+	return a.hi == b.hi && a.lo == b.lo;
+}
+
+constexpr std::partial_ordering operator<=>(const double_double& a, const double_double& b)
+{
+	if (a.hi != b.hi)
+		return a.hi <=> b.hi;
+	return a.lo <=> b.lo;
+}
+
+/**
+* @brief The constants of the elementary functions, each is rounded to double_double
+*/
+namespace double_double_constants
+{
+	inline constexpr double_double pi{ 3.141592653589793116e+00, 1.224646799147353207e-16 };
+	inline constexpr double_double two_pi{ 6.283185307179586232e+00, 2.449293598294706414e-16 };
+	inline constexpr double_double half_pi{ 1.570796326794896558e+00, 6.123233995736766036e-17 };
+	inline constexpr double_double e{ 2.718281828459045091e+00, 1.445646891729250158e-16 };
+	inline constexpr double_double ln2{ 6.931471805599452862e-01, 2.319046813846299558e-17 };
+	inline constexpr double_double ln10{ 2.302585092994045901e+00, -2.170756223382249351e-16 };
+	inline constexpr double_double two_over_sqrt_pi{ 1.128379167095512559e+00, 1.533545961316588122e-17 };
+	inline constexpr double_double half_ln_two_pi{ 9.189385332046727806e-01, -3.878294158067241450e-17 };
+}
+
+template <>
+class std::numeric_limits<double_double>
+{
+public:
+	static constexpr bool is_specialized = true;
+	static constexpr bool is_signed = true;
+	static constexpr bool is_integer = false;
+	static constexpr bool is_exact = false;
+	static constexpr bool has_infinity = true;
+	static constexpr bool has_quiet_NaN = true;
+	static constexpr bool has_signaling_NaN = false;
+	static constexpr std::float_denorm_style has_denorm = std::denorm_absent;
+	static constexpr bool has_denorm_loss = false;
+	static constexpr std::float_round_style round_style = std::round_to_nearest;
+	static constexpr bool is_iec559 = false;
+	static constexpr bool is_bounded = true;
+	static constexpr bool is_modulo = false;
+	static constexpr int digits = 104;
+	static constexpr int digits10 = 31;
+	static constexpr int max_digits10 = 33;
+	static constexpr int radix = 2;
+	static constexpr int min_exponent = -968; // below it the trailing part loses bits
+	static constexpr int min_exponent10 = -291;
+	static constexpr int max_exponent = 1024;
+	static constexpr int max_exponent10 = 308;
+	static constexpr bool traps = false;
+	static constexpr bool tinyness_before = false;
+
+	static constexpr double_double min() noexcept { return { 2.0041683600089728e-292, 0 }; }
+	static constexpr double_double max() noexcept { return { 1.79769313486231570815e+308, 9.97920154767359795037e+291 }; }
+	static constexpr double_double lowest() noexcept { return { -1.79769313486231570815e+308, -9.97920154767359795037e+291 }; }
+	static constexpr double_double epsilon() noexcept { return { 4.93038065763132378382e-32, 0 }; }
+	static constexpr double_double round_error() noexcept { return { 0.5, 0 }; }
+	static constexpr double_double infinity() noexcept { return { std::numeric_limits<double>::infinity(), 0 }; }
+	static constexpr double_double quiet_NaN() noexcept { return { std::numeric_limits<double>::quiet_NaN(), std::numeric_limits<double>::quiet_NaN() }; }
+	static constexpr double_double signaling_NaN() noexcept { return quiet_NaN(); }
+	static constexpr double_double denorm_min() noexcept { return min(); }
+};
+
+namespace std::numbers
+{
+	template <>
+	inline constexpr double_double pi_v<double_double> = double_double_constants::pi;
+
+	template <>
+	inline constexpr double_double e_v<double_double> = double_double_constants::e;
+
+	template <>
+	inline constexpr double_double ln2_v<double_double> = double_double_constants::ln2;
+
+	template <>
+	inline constexpr double_double ln10_v<double_double> = double_double_constants::ln10;
+}
+
+/*
+* The overloads of the <cmath> functions for double_double.
+* They are declared next to the type, so the unqualified calls of the generic code (series_math::pow(this->x, n), see series_math.h)
+* find them by the argument-dependent lookup, while the built-in types get the std:: overloads.
+* The elementary functions reduce the argument and then either sum a short Taylor series or make one Newton step
+* from the double result, which doubles the number of correct digits.
+*/
+inline bool isfinite(const double_double& a)
+{
+	return std::isfinite(a.hi);
+}
+
+inline bool isnan(const double_double& a)
+{
+	return std::isnan(a.hi);
+}
+
+inline bool isinf(const double_double& a)
+{
+	return std::isinf(a.hi);
+}
+
+inline bool signbit(const double_double& a)
+{
+	return std::signbit(a.hi);
+}
+
+inline double_double abs(const double_double& a)
+{
+	return a.hi < 0 ? -a : a;
+}
+
+inline double_double fabs(const double_double& a)
+{
+	return abs(a);
+}
+
+inline double_double floor(const double_double& a)
+{
+	const double hi = std::floor(a.hi);
+	if (hi != a.hi)
+		return { hi, 0 };
+	double s, e;
+	quick_two_sum(hi, std::floor(a.lo), s, e);
+	return { s, e };
+}
+
+inline double_double ceil(const double_double& a)
+{
+	return -floor(-a);
+}
+
+inline double_double trunc(const double_double& a)
+{
+	return a.hi < 0 ? ceil(a) : floor(a);
+}
+
+inline double_double ldexp(const double_double& a, const int exp)
+{
+	return { std::ldexp(a.hi, exp), std::ldexp(a.lo, exp) };
+}
+
+inline double_double fma(const double_double& a, const double_double& b, const double_double& c)
+{
+	return a * b + c; // the product is already exact to double_double
+}
+
+inline double_double sqrt(const double_double& a)
+{
+	if (a.hi <= 0 || !std::isfinite(a.hi))
+		return { std::sqrt(a.hi), 0 };
+	// Karp's trick: sqrt(a) = a * x + (a - (a * x)^2) * x / 2 where x = 1 / sqrt(a) in double
+	const double x = 1 / std::sqrt(a.hi);
+	const double ax = a.hi * x;
+	double p, e;
+	two_prod(ax, ax, p, e);
+	return double_double(ax) + (a - double_double(p, e)).hi * (x * 0.5);
+}
+
+inline double_double exp(const double_double& a)
+{
+	if (a.hi > 709.79)
+		return std::numeric_limits<double_double>::infinity();
+	if (a.hi < -745.2)
+		return 0;
+	if (a.hi == 0)
+		return 1;
+
+	// a = k * ln2 + 512 * r, e^a = 2^k * (e^r)^512 with |r| <= ln2 / 1024
+	const double k = std::floor(a.hi / double_double_constants::ln2.hi + 0.5);
+	const double_double r = ldexp(a - double_double_constants::ln2 * k, -9);
+
+	// s = e^r - 1 keeps the relative accuracy through the squarings
+	double_double s = r;
+	double_double term = r;
+	for (int i = 2; std::abs(term.hi) > 1e-36; ++i)
+	{
+		term = term * r / i;
+		s += term;
+	}
+	for (int i = 0; i < 9; ++i)
+		s = s * (s + 2); // e^{2r} - 1 = (e^r - 1) * (e^r + 1)
+	return ldexp(s + 1, static_cast<int>(k));
+}
+
+inline double_double log(const double_double& a)
+{
+	if (a.hi <= 0 || !std::isfinite(a.hi))
+		return { std::log(a.hi), 0 };
+	if (a.hi == 1 && a.lo == 0)
+		return 0;
+	// Newton step for e^x = a: x = x + a * e^{-x} - 1
+	const double_double x = std::log(a.hi);
+	return x + a * exp(-x) - 1;
+}
+
+inline double_double log10(const double_double& a)
+{
+	return log(a) / double_double_constants::ln10;
+}
+
+template <typename I> requires std::is_integral_v<I>
+inline double_double pow(const double_double& a, const I n)
+{
+	using unsigned_type = std::make_unsigned_t<I>;
+	unsigned_type m = n < 0 ? unsigned_type(0) - static_cast<unsigned_type>(n) : static_cast<unsigned_type>(n);
+	double_double result = 1;
+	double_double square = a;
+	for (; m; m >>= 1)
+	{
+		if (m & 1)
+			result *= square;
+		if (m > 1)
+			square *= square;
+	}
+	return n < 0 ? 1 / result : result;
+}
+
+inline double_double pow(const double_double& a, const double_double& b)
+{
+	if (floor(b) == b && std::abs(b.hi) < 0x1p53)
+		return pow(a, static_cast<long long>(b.hi) + static_cast<long long>(b.lo));
+	return exp(b * log(a));
+}
+
+/**
+* @brief sin and cos of the reduced argument |t| <= pi / 4, the Taylor series of sin and cos = sqrt(1 - sin^2), which has no cancellation there
+*/
+inline void dd_sin_cos_reduced(const double_double& t, double_double& s, double_double& c)
+{
+	const double_double t_squared = t * t;
+	s = t;
+	double_double term = t;
+	for (int i = 2; std::abs(term.hi) > 1e-36; i += 2)
+	{
+		term = -term * t_squared / (i * (i + 1));
+		s += term;
+	}
+	c = sqrt(1 - s * s);
+}
+
+inline void dd_sin_cos(const double_double& a, double_double& s, double_double& c)
+{
+	// a = 2 * pi * z + pi / 2 * j + t, |t| <= pi / 4
+	const double_double r = a - double_double_constants::two_pi * std::floor(a.hi / double_double_constants::two_pi.hi + 0.5);
+	const double j = std::floor(r.hi / double_double_constants::half_pi.hi + 0.5);
+	double_double sin_t, cos_t;
+	dd_sin_cos_reduced(r - double_double_constants::half_pi * j, sin_t, cos_t);
+	switch (static_cast<int>(j))
+	{
+	case 0:
+		s = sin_t, c = cos_t;
+		break;
+	case 1:
+		s = cos_t, c = -sin_t;
+		break;
+	case -1:
+		s = -cos_t, c = sin_t;
+		break;
+	default: // j = -2 or 2
+		s = -sin_t, c = -cos_t;
+	}
+}
+
+inline double_double sin(const double_double& a)
+{
+	double_double s, c;
+	dd_sin_cos(a, s, c);
+	return s;
+}
+
+inline double_double cos(const double_double& a)
+{
+	double_double s, c;
+	dd_sin_cos(a, s, c);
+	return c;
+}
+
+inline double_double sinh(const double_double& a)
+{
+	if (std::abs(a.hi) > 0.5)
+	{
+		const double_double e = exp(a);
+		return (e - 1 / e) * 0.5;
+	}
+	// e^a - e^{-a} cancels for small a, the Taylor series does not
+	const double_double a_squared = a * a;
+	double_double s = a;
+	double_double term = a;
+	for (int i = 2; std::abs(term.hi) > 1e-36 * std::abs(a.hi); i += 2)
+	{
+		term = term * a_squared / (i * (i + 1));
+		s += term;
+	}
+	return s;
+}
+
+inline double_double cosh(const double_double& a)
+{
+	const double_double e = exp(a);
+	return (e + 1 / e) * 0.5;
+}
+
+inline double_double atan(const double_double& a)
+{
+	if (!std::isfinite(a.hi))
+		return std::atan(a.hi);
+	// Newton step for sin(y) - a * cos(y) = 0
+	const double_double y = std::atan(a.hi);
+	double_double s, c;
+	dd_sin_cos(y, s, c);
+	return y + (a * c - s) / (c + a * s);
+}
+
+inline double_double asin(const double_double& a)
+{
+	const double_double abs_a = abs(a);
+	if (abs_a > 1)
+		return std::numeric_limits<double_double>::quiet_NaN();
+	if (abs_a == 1)
+		return a.hi > 0 ? double_double_constants::half_pi : -double_double_constants::half_pi;
+	// Newton step for sin(y) - a = 0
+	const double_double y = std::asin(a.hi);
+	double_double s, c;
+	dd_sin_cos(y, s, c);
+	return y - (s - a) / c;
+}
+
+inline double_double erf(const double_double& a)
+{
+	if (std::abs(a.hi) > 6)
+		return (1 - double_double(std::erfc(std::abs(a.hi)))) * (a.hi > 0 ? 1 : -1); // erfc is below 2e-17, its double value is enough
+	// erf(a) = 2 / sqrt(pi) * e^{-a^2} * sum 2^n a^{2n+1} / (1 * 3 * ... * (2n + 1)), the terms are positive, so nothing cancels
+	const double_double a_squared = a * a;
+	double_double s = a;
+	double_double term = a;
+	for (int n = 1; std::abs(term.hi) > 1e-36 * std::abs(s.hi); ++n)
+	{
+		term = term * a_squared * 2 / (2 * n + 1);
+		s += term;
+	}
+	return double_double_constants::two_over_sqrt_pi * exp(-a_squared) * s;
+}
+
+inline double_double tgamma(const double_double& a)
+{
+	if (!std::isfinite(a.hi))
+		return std::tgamma(a.hi);
+	if (a.hi <= 0 && floor(a) == a)
+		return std::numeric_limits<double_double>::quiet_NaN();
+	if (a.hi < 0.5) // reflection formula
+		return double_double_constants::pi / (sin(double_double_constants::pi * a) * tgamma(1 - a));
+	if (a.hi > 171.7)
+		return std::numeric_limits<double_double>::infinity();
+
+	// the (half-)integer arguments are the products from gamma(1) = 1 or gamma(1/2) = sqrt(pi)
+	const double_double doubled = a * 2;
+	if (floor(doubled) == doubled)
+	{
+		double_double result = floor(a) == a ? double_double(1) : sqrt(double_double_constants::pi);
+		for (double_double z = a - 1; z.hi > 0; z -= 1)
+			result *= z;
+		return result;
+	}
+
+	// Stirling series at z = a + shift >= 40, gamma(a) = gamma(z) / (a * (a + 1) * ... * (z - 1))
+	constexpr std::array<std::array<double, 2>, 12> stirling_coefficients{ { { 1, 12 }, { -1, 360 }, { 1, 1260 }, { -1, 1680 }, { 1, 1188 }, { -691, 360360 },
+		{ 1, 156 }, { -3617, 122400 }, { 43867, 244188 }, { -174611, 125400 }, { 854513, 63756 }, { -236364091, 1506960 } } };
+	double_double z = a;
+	double_double denominator = 1;
+	for (; z.hi < 40; z += 1)
+		denominator *= z;
+	const double_double z_squared = z * z;
+	double_double correction = 0;
+	double_double z_power = z; // z^{2k-1}
+	for (const auto& [numerator, divisor] : stirling_coefficients)
+	{
+		correction += double_double(numerator) / divisor / z_power;
+		z_power *= z_squared;
+	}
+	const double_double log_gamma = (z - 0.5) * log(z) - z + double_double_constants::half_ln_two_pi + correction;
+	return exp(log_gamma) / denominator;
+}
+
+/**
+* @brief The Bessel function of the first kind as the power series sum (-1)^k (x/2)^{2k+nu} / (k! * gamma(k + nu + 1))
+* The terms grow up to k ~ x / 2 before they decay, so the accuracy drops for the large x
+*/
+inline double_double cyl_bessel_j(const double_double& nu, const double_double& x)
+{
+	if (nu.hi < 0 && floor(nu) == nu) // J_{-n} = (-1)^n J_n
+		return (static_cast<long long>(nu.hi) % 2 ? -1 : 1) * cyl_bessel_j(-nu, x);
+	const double_double half_x = x * 0.5;
+	const double_double minus_half_x_squared = -half_x * half_x;
+	double_double term = pow(half_x, nu) / tgamma(nu + 1);
+	double_double s = term;
+	for (int k = 1; k <= std::abs(half_x.hi) || std::abs(term.hi) > 1e-36 * std::abs(s.hi); ++k)
+	{
+		term = term * minus_half_x_squared / (k * (nu + k));
+		s += term;
+	}
+	return s;
+}
+
+template <typename A> requires std::is_arithmetic_v<A>
+constexpr double_double::operator A() const
+{
+	if constexpr (std::is_integral_v<A>)
+	{
+		const double_double t = trunc(*this);
+		return static_cast<A>(static_cast<A>(t.hi) + static_cast<A>(t.lo));
+	}
+	else
+		return static_cast<A>(hi) + static_cast<A>(lo);
+}
+
+/**
+* @brief Prints the number in the format of the stream (std::fixed, std::scientific or the default one) with up to 32 significant digits
+*/
+inline std::ostream& operator<<(std::ostream& os, const double_double& a)
+{
+	if (!std::isfinite(a.hi))
+		return os << a.hi;
+
+	constexpr int max_digits = 32;
+	const auto flags = os.flags();
+	const bool fixed = (flags & std::ios::floatfield) == std::ios::fixed;
+	const bool scientific = (flags & std::ios::floatfield) == std::ios::scientific;
+	const int precision = static_cast<int>(os.precision());
+
+	std::string result = a.hi < 0 || (a.hi == 0 && std::signbit(a.hi)) ? "-" : (flags & std::ios::showpos ? "+" : "");
+	double_double r = abs(a);
+
+	// the decimal digits d_0.d_1 d_2 ... of r = d_0.d_1 d_2 ... * 10^exponent
+	int exponent = r.hi == 0 ? 0 : static_cast<int>(std::floor(std::log10(r.hi)));
+	if (r.hi != 0)
+	{
+		r = exponent < 0 ? r * pow(double_double(10), -exponent) : r / pow(double_double(10), exponent);
+		if (r.hi >= 10)
+			r = r / 10, ++exponent;
+		else if (r.hi < 1)
+			r = r * 10, --exponent;
+	}
+	int count = scientific ? precision + 1 : fixed ? exponent + 1 + precision : std::max(precision, 1);
+	count = std::max(0, std::min(count, max_digits));
+	std::array<int, max_digits + 1> digits{};
+	for (int i = 0; i <= count; ++i)
+	{
+		const double_double d = floor(r);
+		digits[i] = static_cast<int>(d.hi);
+		r = (r - d) * 10;
+	}
+	// the floor of the inexact r may be off by one, the carries fix it
+	for (int i = count; i > 0; --i)
+	{
+		if (digits[i] < 0)
+			digits[i] += 10, --digits[i - 1];
+		else if (digits[i] > 9)
+			digits[i] -= 10, ++digits[i - 1];
+	}
+	if (digits[count] >= 5) // rounding to count digits
+	{
+		int i = count - 1;
+		for (; i >= 0 && digits[i] == 9; --i)
+			digits[i] = 0;
+		if (i >= 0)
+			++digits[i];
+		else // 99...9 rounds to 100...0, one more digit before the point
+		{
+			digits.fill(0);
+			digits[0] = 1;
+			++exponent;
+			if (fixed)
+				++count;
+		}
+	}
+	if (count == 0 && digits[0] == 0) // fixed format of a value below 10^{-precision}
+		exponent = -precision - 1;
+
+	const auto digit = [&](const int i) { return static_cast<char>('0' + (i < count ? digits[i] : 0)); };
+	const bool exponential = scientific || (!fixed && (exponent < -4 || exponent >= std::max(precision, 1)));
+	std::string mantissa;
+	if (exponential)
+	{
+		mantissa += digit(0);
+		std::string fraction;
+		for (int i = 1; i < count; ++i)
+			fraction += digit(i);
+		if (!scientific && !(flags & std::ios::showpoint))
+			fraction.erase(fraction.find_last_not_of('0') + 1);
+		if (!fraction.empty())
+			mantissa += '.' + fraction;
+		const int abs_exponent = std::abs(exponent);
+		mantissa += std::string(exponent < 0 ? "e-" : "e+") + (abs_exponent < 10 ? "0" : "") + std::to_string(abs_exponent);
+	}
+	else
+	{
+		const int fraction_digits = fixed ? precision : std::max(0, count - 1 - exponent);
+		for (int i = 0; i <= exponent; ++i)
+			mantissa += digit(i);
+		if (exponent < 0)
+			mantissa += '0';
+		std::string fraction;
+		for (int i = exponent + 1; i < exponent + 1 + fraction_digits; ++i)
+			fraction += i < 0 ? '0' : digit(i);
+		if (!fixed && !(flags & std::ios::showpoint))
+			fraction.erase(fraction.find_last_not_of('0') + 1);
+		if (!fraction.empty())
+			mantissa += '.' + fraction;
+	}
+	result += mantissa;
+
+	const auto width = os.width(0);
+	if (static_cast<std::streamsize>(result.size()) < width)
+		result.insert((flags & std::ios::left) ? result.size() : 0, width - result.size(), os.fill());
+	return os << result;
+}
+
+/**
+* @brief Converts the number to the string the way std::to_string converts the doubles, with 6 digits after the point
+*/
+inline std::string to_string(const double_double& a)
+{
+	std::ostringstream os;
+	os << std::fixed << a;
+	return os.str();
+}
+
+/**
+* @brief Reads the number written in the decimal notation (e.g. -1.25e-3), all of its digits are taken into account
+*/
+inline std::istream& operator>>(std::istream& is, double_double& a)
+{
+	std::string token;
+	if (!(is >> token))
+		return is;
+
+	std::size_t i = 0;
+	const bool negative = token[i] == '-';
+	if (token[i] == '-' || token[i] == '+')
+		++i;
+	double_double mantissa = 0;
+	int exponent = 0;
+	bool any_digit = false;
+	for (bool fraction = false; i < token.size(); ++i)
+	{
+		if (token[i] == '.' && !fraction)
+			fraction = true;
+		else if (token[i] >= '0' && token[i] <= '9')
+		{
+			mantissa = mantissa * 10 + (token[i] - '0');
+			exponent -= fraction;
+			any_digit = true;
+		}
+		else
+			break;
+	}
+	if (i < token.size() && (token[i] == 'e' || token[i] == 'E'))
+	{
+		std::size_t parsed = 0;
+		try
+		{
+			exponent += std::stoi(token.substr(i + 1), &parsed);
+		}
+		catch (const std::exception&)
+		{
+			parsed = 0;
+		}
+		i += parsed ? parsed + 1 : 0;
+	}
+	if (!any_digit || i != token.size())
+	{
+		is.setstate(std::ios::failbit);
+		return is;
+	}
+	const double_double power = pow(double_double(10), std::abs(exponent));
+	a = exponent < 0 ? mantissa / power : mantissa * power;
+	if (negative)
+		a = -a;
+	return is;
+}
+
+/**
+* @brief Pack of double_double lanes, the high and the low parts of the lanes lie in two registers (the structure of arrays layout)
+* so the double-double kernels run on whole registers and simd_kernels.h vectorizes the series of double_double terms.
+*/
+template <>
+struct simd_pack<double_double>
+{
+	static constexpr std::size_t width = simd_pack<double>::width;
+	simd_pack<double> hi;
+	simd_pack<double> lo;
+
+	static simd_pack broadcast(double_double a) { return { simd_pack<double>::broadcast(a.hi), simd_pack<double>::broadcast(a.lo) }; }
+	static simd_pack load(const double_double* p)
+	{
+		std::array<double, width> hi, lo;
+		for (std::size_t j = 0; j < width; ++j)
+			hi[j] = p[j].hi, lo[j] = p[j].lo;
+		return { simd_pack<double>::load(hi.data()), simd_pack<double>::load(lo.data()) };
+	}
+	void store(double_double* p) const
+	{
+		std::array<double, width> hi_lanes, lo_lanes;
+		hi.store(hi_lanes.data());
+		lo.store(lo_lanes.data());
+		for (std::size_t j = 0; j < width; ++j)
+			p[j] = { hi_lanes[j], lo_lanes[j] };
+	}
+	friend simd_pack operator+(simd_pack a, simd_pack b) { return dd_add(a, b); }
+	friend simd_pack operator-(simd_pack a, simd_pack b) { return dd_sub(a, b); }
+	friend simd_pack operator-(simd_pack a) { return { -a.hi, -a.lo }; }
+	friend simd_pack operator*(simd_pack a, simd_pack b) { return dd_mul(a, b); }
+	friend simd_pack operator/(simd_pack a, simd_pack b) { return dd_div(a, b); }
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c) { return dd_add(dd_mul(a, b), c); }
+};
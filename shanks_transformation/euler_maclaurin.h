@@ -0,0 +1,261 @@
+/**
+ * @file euler_maclaurin.h
+ * @brief This file contains the declaration of the Euler-Maclaurin summation class: the partial sum plus the asymptotic estimate of the remainder.
+ */
+
+#pragma once
+
+#include "series_acceleration.h" // Include the series header
+#include <array> // Include the array library
+#include <vector> // Include the vector library
+#include <numbers> // Include the numbers library for std::numbers::pi_v
+#include <limits> // Include the limits library
+
+/**
+ * @brief Euler-Maclaurin summation class template.
+ * For the series whose term is a smooth function of n, a_n = f(n), see series_base::smooth_term, the remainder after S_n is
+ * sum_{k >= N} f(k) = int_N^inf f(x) dx + f(N) / 2 - sum_{j = 1}^{p} B_{2j} / (2j)! f^{(2j-1)}(N) + R_p, where N = n + 1 and p is the order.
+ * For the alternating series a_n = (-1)^n f(n) it is the Boole summation, which needs no integral:
+ * sum_{k >= N} (-1)^k f(k) = (-1)^N (f(N) / 2 - sum_{j = 1}^{p} (2^{2j} - 1) B_{2j} / (2j)! f^{(2j-1)}(N)) + R_p.
+ * The derivatives of f come from a taylor_jet and the integral from the Gauss-Legendre quadrature in t = N / x, which is exact up to the rounding
+ * when f(x) = x^{-s} g(1 / x) with an integer s >= 2 and g analytic, as for the rational terms.
+ * For the completely monotone f the remainder R_p is smaller than the first omitted correction, see error_estimate,
+ * so a few hundred terms and a moderate order give the full precision of T.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class euler_maclaurin_algorithm : public series_acceleration<T, K, series_templ>
+{
+public:
+	/**
+   * @brief The highest order of the summation, it is limited by the table of the Bernoulli numbers
+   */
+	static constexpr int max_order = 17;
+
+	/**
+   * @brief Parameterized constructor to initialize the Euler-Maclaurin summation.
+   * @param series The series class object to be accelerated, it must provide series_base::smooth_term
+   * @param alternating Whether the series is alternating, a_n = (-1)^n f(n)
+   * @throws std::domain_error if the series does not provide its term as a smooth function
+   */
+	euler_maclaurin_algorithm(const series_templ& series, const bool alternating = false);
+
+	/**
+   * @brief Euler-Maclaurin summation.
+   * Computes S_n plus the estimate of the remainder a_{n+1} + a_{n+2} + ... with order corrections.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation, 0 means no transformation, the orders above max_order give NaN.
+   * @return The partial sum after the transformation.
+   */
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N in one pass
+   * The partial sums are computed once, only the remainders are estimated for every n.
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The vector of T_1, ..., T_N
+   */
+	std::vector<T> sweep(const K N, const int order) const override;
+
+	/**
+   * @brief The bound of the truncation error of the transformed partial sum: the magnitude of the first omitted correction
+   * It is a rigorous bound for the completely monotone f, e.g. the rational terms beyond their poles, the rounding errors of S_n are not included
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation, from 1 to max_order.
+   * @return The bound, NaN if order is out of range
+   */
+	T error_estimate(const K n, const int order) const;
+
+	/**
+   * @brief The number of the terms a_0, a_1, ... the transformed partial sum T_n of the given order depends on
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	K terms_required(const K n, const int order) const override;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order), the terms are evaluated once for all n
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	std::size_t sweep_terms_required(const K N, const int order) const override;
+
+	/**
+   * @brief The rough number of the arithmetic operations spent on the transformed partial sum T_n of the given order, apart from computing the terms
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of operations
+   */
+	std::size_t operations_required(const K n, const int order) const override;
+
+private:
+	using typename series_acceleration<T, K, series_templ>::term_type;
+
+	/**
+   * @brief The number of the nodes of the Gauss-Legendre quadrature of the integral
+   */
+	static constexpr std::size_t quadrature_nodes = 24;
+
+	/**
+   * @brief Whether the series is alternating
+   */
+	bool alternating;
+
+	/**
+   * @brief The nodes in (0, 1) and the weights of the Gauss-Legendre quadrature
+   */
+	std::vector<T> nodes;
+	std::vector<T> weights;
+
+	/**
+   * @brief The coefficient of f^{(2j-1)}(N) / (2j-1)! in the correction j: B_{2j} / (2j), times 2^{2j} - 1 for the alternating series
+   * @param j The number of the correction, from 1 to max_order + 1
+   */
+	T correction_coefficient(const int j) const;
+
+	/**
+   * @brief The estimate of the remainder a_N + a_{N+1} + ...
+   * @param N The number of the first term of the remainder
+   * @param order The number of the corrections
+   */
+	T remainder(const K N, const int order) const;
+};
+
+template <typename T, typename K, typename series_templ>
+euler_maclaurin_algorithm<T, K, series_templ>::euler_maclaurin_algorithm(const series_templ& series, const bool alternating) :
+	series_acceleration<T, K, series_templ>(series), alternating(alternating), nodes(quadrature_nodes), weights(quadrature_nodes)
+{
+	taylor_jet<term_type> probe(1, 0);
+	if (!this->series->smooth_term(probe))
+		throw std::domain_error("the Euler-Maclaurin summation requires a series with a smooth term");
+
+	// the roots of the Legendre polynomial P_m by the Newton method from the asymptotic guesses, mapped from (-1, 1) to (0, 1)
+	const std::size_t m = quadrature_nodes;
+	for (std::size_t i = 0; i < m; ++i)
+	{
+		T z = series_math::cos(std::numbers::pi_v<T> * (static_cast<T>(i) + static_cast<T>(0.75)) / (static_cast<T>(m) + static_cast<T>(0.5)));
+		T derivative = 0;
+		for (int iteration = 0; iteration < 100; ++iteration)
+		{
+			T p = 1, p_previous = 0; // P_k(z) and P_{k-1}(z)
+			for (std::size_t k = 1; k <= m; ++k)
+			{
+				const T p_next = (static_cast<T>(2 * k - 1) * z * p - static_cast<T>(k - 1) * p_previous) / static_cast<T>(k);
+				p_previous = p;
+				p = p_next;
+			}
+			derivative = static_cast<T>(m) * (z * p - p_previous) / (z * z - 1);
+			const T step = p / derivative;
+			z -= step;
+			if (series_math::abs(step) <= std::numeric_limits<T>::epsilon())
+				break;
+		}
+		nodes[i] = (1 + z) / 2;
+		weights[i] = 1 / ((1 - z * z) * derivative * derivative);
+	}
+}
+
+template <typename T, typename K, typename series_templ>
+T euler_maclaurin_algorithm<T, K, series_templ>::correction_coefficient(const int j) const
+{
+	// the numerators and the denominators of B_2, B_4, ..., B_36, all but the last numerator are exact in double
+	static constexpr std::array<std::array<double, 2>, max_order + 1> bernoulli = { {
+		{ 1, 6 }, { -1, 30 }, { 1, 42 }, { -1, 30 }, { 5, 66 }, { -691, 2730 }, { 7, 6 }, { -3617, 510 }, { 43867, 798 },
+		{ -174611, 330 }, { 854513, 138 }, { -236364091, 2730 }, { 8553103, 6 }, { -23749461029, 870 }, { 8615841276005, 14322 },
+		{ -7709321041217, 510 }, { 2577687858367, 6 }, { -26315271553053477373.0, 1919190 }
+	} };
+	const auto& [numerator, denominator] = bernoulli[j - 1];
+	const T coefficient = static_cast<T>(numerator) / (static_cast<T>(denominator) * (2 * j));
+	return alternating ? coefficient * (series_math::ldexp(static_cast<T>(1), 2 * j) - 1) : coefficient;
+}
+
+template <typename T, typename K, typename series_templ>
+T euler_maclaurin_algorithm<T, K, series_templ>::remainder(const K N, const int order) const
+{
+	SHANKS_TRACE_SPAN("euler-maclaurin remainder");
+	taylor_jet<term_type> f(static_cast<term_type>(N), 2 * order - 1);
+	this->series->smooth_term(f);
+	T correction = 0;
+	for (int j = order; j >= 1; --j) // from the smallest correction
+		correction += correction_coefficient(j) * static_cast<T>(f[2 * j - 1]);
+	const T boundary = static_cast<T>(f[0]) / 2 - correction;
+	if (alternating)
+		return N % 2 ? -boundary : boundary;
+
+	// int_N^inf f(x) dx = int_0^1 N f(N / t) / t^2 dt
+	T integral = 0;
+	for (std::size_t i = 0; i < quadrature_nodes; ++i)
+	{
+		taylor_jet<term_type> value(static_cast<term_type>(static_cast<T>(N) / nodes[i]), 0);
+		this->series->smooth_term(value);
+		integral += weights[i] * static_cast<T>(value[0]) / (nodes[i] * nodes[i]);
+	}
+	return static_cast<T>(N) * integral + boundary;
+}
+
+template <typename T, typename K, typename series_templ>
+T euler_maclaurin_algorithm<T, K, series_templ>::evaluate(const K n, const int order) const
+{
+	if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
+		return this->S_n(n);
+	else if (order > max_order)
+		return std::numeric_limits<T>::quiet_NaN();
+	return this->S_n(n) + remainder(n + 1, order);
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<T> euler_maclaurin_algorithm<T, K, series_templ>::sweep(const K N, const int order) const
+{
+	if (N < 0 || order < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<T> result(N);
+	if (N == 0)
+		return result;
+	std::vector<T> terms(N + 1);
+	std::vector<T> partial_sums(N + 1);
+	SHANKS_COUNT(scratch_bytes, (3 * N + 2) * sizeof(T)); // with the result
+	this->fill_terms_and_partial_sums(0, terms, partial_sums);
+	for (K n = 1; n <= N; ++n)
+	{
+		if (order == 0)
+			result[n - 1] = partial_sums[n];
+		else if (order > max_order)
+			result[n - 1] = std::numeric_limits<T>::quiet_NaN();
+		else
+			result[n - 1] = partial_sums[n] + remainder(n + 1, order);
+	}
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+T euler_maclaurin_algorithm<T, K, series_templ>::error_estimate(const K n, const int order) const
+{
+	if (n < 0 || order < 1 || order > max_order)
+		return std::numeric_limits<T>::quiet_NaN();
+	taylor_jet<term_type> f(static_cast<term_type>(n + 1), 2 * order + 1);
+	this->series->smooth_term(f);
+	return series_math::abs(correction_coefficient(order + 1) * static_cast<T>(f[2 * order + 1]));
+}
+
+template <typename T, typename K, typename series_templ>
+K euler_maclaurin_algorithm<T, K, series_templ>::terms_required(const K n, const int) const
+{
+	return n + 1;
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t euler_maclaurin_algorithm<T, K, series_templ>::sweep_terms_required(const K N, const int order) const
+{
+	return static_cast<std::size_t>(terms_required(N, order));
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t euler_maclaurin_algorithm<T, K, series_templ>::operations_required(const K, const int order) const
+{
+	// about five products or quotients of the jets of the degree 2 * order and the same amount of the scalar ones per node of the quadrature
+	const std::size_t degree = 2 * static_cast<std::size_t>(order);
+	return order == 0 ? 0 : 5 * degree * degree + (alternating ? 0 : 8 * quadrature_nodes);
+}
@@ -0,0 +1,460 @@
+/**
+ * @file grid_runner.h
+ * @brief This file contains the parallel runner of the parameter grids: a work-stealing thread pool and the jobs that evaluate one transformed partial sum each
+ * Every job builds its own series and transformation, so the jobs share no state and the result of a job does not depend on the thread that computed it,
+ * the results of a grid are identical for any number of threads.
+ */
+
+#pragma once
+#include <vector> // Include the vector library
+#include <deque> // Include the deque library for the queues of the workers
+#include <thread> // Include the thread library
+#include <mutex> // Include the mutex library
+#include <condition_variable> // Include the condition_variable library
+#include <functional> // Include the functional library for std::function
+#include <exception> // Include the exception library for std::exception_ptr
+#include <numeric> // Include the numeric library for std::iota
+#include <algorithm> // Include the algorithm library for std::sort and std::min_element
+#include <chrono> // Include the chrono library for std::chrono::steady_clock
+#include <cstring> // Include the cstring library for std::memcmp
+#include "series_factory.h"
+#include "double_double.h"
+
+/**
+ * @brief The floating point type a job of the grid is computed in
+ */
+enum class grid_type_id {
+	float_type,
+	double_type,
+	long_double_type,
+	double_double_type
+};
+
+/**
+ * @brief A point of the parameter grid: the transformed partial sum T_n of the given order of the given series
+ * @tparam K The type of enumerating integer
+ */
+template <typename K>
+struct grid_job
+{
+	int series_id; // see series_id_t
+	int transformation_id; // see transformation_id_t
+	long double x; // the argument of the functional series, it is rounded to the type of the job
+	long double alpha; // the constant of bin_series
+	K b; // the constant of xmb_Jb_two_series
+	K m; // the constant of m_fact_1mx_mp1_inverse_series
+	K n;
+	int order;
+	grid_type_id type;
+};
+
+/**
+ * @brief The result of a job, the double-double value holds the results of all the types of the grid exactly.
+ * If creating the series or the transformation throws, the status is that of the exception, see current_exception_status,
+ * e.g. invalid_argument if they are not defined for the parameters of the job.
+ */
+using grid_result = eval_result<double_double>;
+
+/**
+ * @brief Thread pool that runs a set of independent jobs with work stealing.
+ * Before a run the jobs are sorted by their estimated cost and dealt out to the per-worker queues so that the queues get equal total costs,
+ * every worker takes the most expensive remaining job from the front of its own queue and, when the queue is empty,
+ * steals the cheapest one from the back of the queue of another worker, so the errors of the cost estimates are evened out at the end of the run.
+ * The calling thread is one of the workers.
+ */
+class work_stealing_pool
+{
+public:
+	/**
+   * @brief Parameterized constructor to start the threads of the pool.
+   * @param threads The number of the workers including the calling thread, 0 is treated as 1
+   */
+	explicit work_stealing_pool(const unsigned threads = std::thread::hardware_concurrency());
+
+	/**
+   * @brief Stops and joins the threads of the pool.
+   */
+	~work_stealing_pool();
+
+	work_stealing_pool(const work_stealing_pool&) = delete;
+	work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+	/**
+   * @brief The number of the workers including the calling thread
+   */
+	unsigned size() const;
+
+	/**
+   * @brief Runs task(i) for every job i = 0, ..., costs.size() - 1 and waits for all of them.
+   * If some tasks throw, the first caught exception is rethrown after all the jobs have finished.
+   * @param costs The estimated costs of the jobs, only their ratios matter
+   * @param task The function that runs the job with the given index, it is called concurrently
+   */
+	void run(const std::vector<double>& costs, const std::function<void(std::size_t)>& task);
+
+private:
+	/**
+   * @brief The queue of the indices of the jobs of a worker
+   */
+	struct worker_queue
+	{
+		std::mutex mutex;
+		std::deque<std::size_t> jobs;
+	};
+
+	/**
+   * @brief Takes the next job of the worker: the front of its own queue or the back of the queue of another worker
+   * @param worker The index of the worker
+   * @param job The index of the taken job
+   * @return false if all the queues are empty
+   */
+	bool take(const unsigned worker, std::size_t& job);
+
+	/**
+   * @brief Runs the jobs of the worker until all the queues are empty
+   * @param worker The index of the worker
+   */
+	void work(const unsigned worker);
+
+	/**
+   * @brief The loop of the threads of the pool, they are the workers 1, ..., size() - 1
+   * @param worker The index of the worker
+   */
+	void thread_loop(const unsigned worker);
+
+	std::vector<worker_queue> queues;
+	std::vector<std::thread> threads;
+	const std::function<void(std::size_t)>* task = nullptr; // the task of the current run
+	std::exception_ptr error; // the first exception of the current run
+
+	std::mutex mutex; // guards the fields below and error
+	std::condition_variable started;
+	std::condition_variable finished;
+	std::size_t generation = 0; // the number of the runs started
+	unsigned busy = 0; // the number of the threads still working on the current run
+	bool stopping = false;
+};
+
+inline work_stealing_pool::work_stealing_pool(const unsigned threads) : queues(std::max(threads, 1u))
+{
+	for (unsigned worker = 1; worker < queues.size(); ++worker)
+		this->threads.emplace_back(&work_stealing_pool::thread_loop, this, worker);
+}
+
+inline work_stealing_pool::~work_stealing_pool()
+{
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	started.notify_all();
+	for (auto& thread : threads)
+		thread.join();
+}
+
+inline unsigned work_stealing_pool::size() const
+{
+	return static_cast<unsigned>(queues.size());
+}
+
+inline void work_stealing_pool::run(const std::vector<double>& costs, const std::function<void(std::size_t)>& task)
+{
+	// the longest processing time first: the jobs in the decreasing order of the costs, each to the least loaded worker
+	std::vector<std::size_t> order(costs.size());
+	std::iota(order.begin(), order.end(), 0);
+	std::stable_sort(order.begin(), order.end(), [&](const std::size_t i, const std::size_t j) { return costs[i] > costs[j]; });
+	std::vector<double> load(queues.size(), 0);
+	for (const std::size_t job : order)
+	{
+		const auto worker = std::min_element(load.begin(), load.end()) - load.begin();
+		load[worker] += costs[job];
+		queues[worker].jobs.push_back(job);
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		this->task = &task;
+		error = nullptr;
+		busy = static_cast<unsigned>(threads.size());
+		++generation;
+	}
+	started.notify_all();
+	work(0);
+	std::unique_lock<std::mutex> lock(mutex);
+	finished.wait(lock, [this] { return busy == 0; });
+	this->task = nullptr;
+	if (error)
+		std::rethrow_exception(error);
+}
+
+inline bool work_stealing_pool::take(const unsigned worker, std::size_t& job)
+{
+	{
+		std::lock_guard<std::mutex> lock(queues[worker].mutex);
+		if (!queues[worker].jobs.empty())
+		{
+			job = queues[worker].jobs.front();
+			queues[worker].jobs.pop_front();
+			return true;
+		}
+	}
+	for (std::size_t k = 1; k < queues.size(); ++k)
+	{
+		auto& victim = queues[(worker + k) % queues.size()];
+		std::lock_guard<std::mutex> lock(victim.mutex);
+		if (!victim.jobs.empty())
+		{
+			job = victim.jobs.back();
+			victim.jobs.pop_back();
+			return true;
+		}
+	}
+	return false; // the jobs are only added before the run, so the empty queues stay empty
+}
+
+inline void work_stealing_pool::work(const unsigned worker)
+{
+	std::size_t job;
+	while (take(worker, job))
+	{
+		try
+		{
+			(*task)(job);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (!error)
+				error = std::current_exception();
+		}
+	}
+}
+
+inline void work_stealing_pool::thread_loop(const unsigned worker)
+{
+	std::size_t seen = 0;
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			started.wait(lock, [&] { return stopping || generation != seen; });
+			if (stopping)
+				return;
+			seen = generation;
+		}
+		work(worker);
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			--busy;
+		}
+		finished.notify_one();
+	}
+}
+
+/**
+* @brief The rough relative cost of a term of the series: the terms computed with a factorial or a binomial coefficient cost O(n),
+* the ones computed with std::tgamma cost more than an arithmetic operation
+* @param series_id The id of the series, see series_id_t
+* @param n The number of the term
+* @return The cost of a term in the arithmetic operations
+*/
+inline double grid_term_cost(const int series_id, const double n)
+{
+	switch (series_id)
+	{
+	case series_id_t::exp_series_id:
+	case series_id_t::cos_series_id:
+	case series_id_t::sin_series_id:
+	case series_id_t::cosh_series_id:
+	case series_id_t::sinh_series_id:
+	case series_id_t::bin_series_id:
+	case series_id_t::mean_sinh_sin_series_id:
+	case series_id_t::xmb_Jb_two_series_id:
+	case series_id_t::half_asin_two_x_series_id:
+	case series_id_t::erf_series_id:
+	case series_id_t::m_fact_1mx_mp1_inverse_series_id:
+	case series_id_t::inverse_sqrt_1m4x_series_id:
+	case series_id_t::exp_m_cos_x_sinsin_x_series_id:
+		return 4 + n;
+	case series_id_t::exp_squared_erf_series_id:
+		return 64;
+	default:
+		return 4;
+	}
+}
+
+/**
+* @brief The estimated cost of a job: the terms the transformed partial sum depends on and the operations of the transformation,
+* scaled by the relative cost of the arithmetic of the type of the job
+* @tparam K The type of enumerating integer
+* @param job The job
+* @return The cost in the double precision operations
+*/
+template <typename K>
+double grid_job_cost(const grid_job<K>& job)
+{
+	if (job.n < 0 || job.order < 0)
+		return 1;
+	double cost = 0;
+	try
+	{
+		// the amounts of the work do not depend on the series, a cheap one stands in for it
+		one_series<double, K> stand_in;
+		series_base<double, K>* const series = &stand_in;
+		const auto transform = make_transformation<double, K>(job.transformation_id, series, is_alternating_series(job.series_id));
+		const double terms = static_cast<double>(transform->terms_required(job.n, job.order));
+		cost = terms * grid_term_cost(job.series_id, terms) + static_cast<double>(transform->operations_required(job.n, job.order));
+	}
+	catch (std::domain_error&)
+	{
+		return 1; // the job fails at once
+	}
+	if (job.series_id == series_id_t::xmb_Jb_two_series_id)
+		cost += 1024; // the sum is computed with std::cyl_bessel_j
+	switch (job.type)
+	{
+	case grid_type_id::long_double_type: // the x87 arithmetic
+	case grid_type_id::double_double_type: // the error-free transformations and the functions on the pairs of doubles
+		return 6 * cost;
+	default:
+		return cost;
+	}
+}
+
+/**
+* @brief Evaluates a job in the type T
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @param job The job
+* @return The transformed partial sum and its status, see series_acceleration::try_eval
+*/
+template <typename T, typename K>
+grid_result evaluate_grid_job(const grid_job<K>& job)
+{
+	SHANKS_TRACE_SPAN("grid job");
+	try
+	{
+		const auto series = make_series<T, K>(job.series_id, static_cast<T>(job.x), static_cast<T>(job.alpha), job.b, job.m);
+		const auto transform = make_transformation<T, K>(job.transformation_id, series.get(), is_alternating_series(job.series_id));
+		const auto result = transform->try_eval(job.n, job.order);
+		return { double_double(result.value), result.status };
+	}
+	catch (...) // e.g. the series or the transformation is not defined for the parameters
+	{
+		return { std::numeric_limits<double_double>::quiet_NaN(), current_exception_status() };
+	}
+}
+
+/**
+* @brief Evaluates a job in its type
+* @tparam K The type of enumerating integer
+* @param job The job
+* @return The transformed partial sum and its status
+*/
+template <typename K>
+grid_result evaluate_grid_job(const grid_job<K>& job)
+{
+	switch (job.type)
+	{
+	case grid_type_id::float_type:
+		return evaluate_grid_job<float, K>(job);
+	case grid_type_id::double_type:
+		return evaluate_grid_job<double, K>(job);
+	case grid_type_id::long_double_type:
+		return evaluate_grid_job<long double, K>(job);
+	case grid_type_id::double_double_type:
+		return evaluate_grid_job<double_double, K>(job);
+	default:
+		return { std::numeric_limits<double_double>::quiet_NaN(), eval_status::invalid_argument };
+	}
+}
+
+/**
+* @brief The Cartesian product of the parameters, the last parameter changes the fastest
+* @tparam K The type of enumerating integer
+* @param series_ids The ids of the series
+* @param xs The arguments of the series
+* @param ns The numbers of terms
+* @param orders The orders of the transformations
+* @param transformation_ids The ids of the transformations
+* @param types The types of the computations
+* @param alpha The constant of bin_series
+* @param b The constant of xmb_Jb_two_series
+* @param m The constant of m_fact_1mx_mp1_inverse_series
+* @return The jobs of the grid
+*/
+template <typename K>
+std::vector<grid_job<K>> make_grid(const std::vector<int>& series_ids, const std::vector<long double>& xs, const std::vector<K>& ns, const std::vector<int>& orders,
+	const std::vector<int>& transformation_ids, const std::vector<grid_type_id>& types, const long double alpha = 0, const K b = 0, const K m = 0)
+{
+	std::vector<grid_job<K>> jobs;
+	jobs.reserve(series_ids.size() * xs.size() * ns.size() * orders.size() * transformation_ids.size() * types.size());
+	for (const int series_id : series_ids)
+		for (const long double x : xs)
+			for (const K n : ns)
+				for (const int order : orders)
+					for (const int transformation_id : transformation_ids)
+						for (const grid_type_id type : types)
+							jobs.push_back({ series_id, transformation_id, x, alpha, b, m, n, order, type });
+	return jobs;
+}
+
+/**
+* @brief Evaluates all the jobs of the grid on the pool
+* @tparam K The type of enumerating integer
+* @param jobs The jobs
+* @param pool The pool
+* @return The results, the element i is the result of the job i
+*/
+template <typename K>
+std::vector<grid_result> run_grid(const std::vector<grid_job<K>>& jobs, work_stealing_pool& pool)
+{
+	std::vector<double> costs(jobs.size());
+	std::transform(jobs.begin(), jobs.end(), costs.begin(), grid_job_cost<K>);
+	std::vector<grid_result> results(jobs.size());
+	pool.run(costs, [&](const std::size_t i) { results[i] = evaluate_grid_job(jobs[i]); });
+	return results;
+}
+
+/**
+ * @brief The time of a run of the grid on the given number of threads
+ */
+struct grid_timing
+{
+	unsigned threads;
+	double milliseconds; // the best of the repetitions
+	bool identical; // whether the results are bitwise equal to the ones on a single thread
+};
+
+/**
+* @brief Runs the grid on 1, 2, ..., max_threads threads and measures the wall time of each run with std::chrono::steady_clock
+* @tparam K The type of enumerating integer
+* @param jobs The jobs
+* @param max_threads The largest number of threads
+* @param repetitions The number of the runs on every number of threads, the best time is taken
+* @return The timings for 1, ..., max_threads threads
+*/
+template <typename K>
+std::vector<grid_timing> grid_scaling(const std::vector<grid_job<K>>& jobs, const unsigned max_threads, const int repetitions = 3)
+{
+	std::vector<grid_timing> timings;
+	std::vector<grid_result> reference;
+	for (unsigned threads = 1; threads <= std::max(max_threads, 1u); ++threads)
+	{
+		work_stealing_pool pool(threads);
+		grid_timing timing = { threads, std::numeric_limits<double>::infinity(), true };
+		for (int r = 0; r < std::max(repetitions, 1); ++r)
+		{
+			const auto start_time = std::chrono::steady_clock::now();
+			const auto results = run_grid(jobs, pool);
+			const std::chrono::duration<double, std::milli> diff = std::chrono::steady_clock::now() - start_time;
+			timing.milliseconds = std::min(timing.milliseconds, diff.count());
+			if (reference.empty())
+				reference = results;
+			for (std::size_t i = 0; i < results.size(); ++i)
+				timing.identical = timing.identical && results[i].status == reference[i].status &&
+					std::memcmp(&results[i].value, &reference[i].value, sizeof(double_double)) == 0; // NaN results are compared bitwise as well
+		}
+		timings.push_back(timing);
+	}
+	return timings;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file instrumentation.h
+ * @brief This file contains the optional counters of the work done by the series and the transformations:
+ * the terms and the partial sums evaluated, the divisions, the table cells computed and the scratch memory requested.
+ * The terms, the partial sums and the scratch memory are counted where they are used, so they do not depend on the earlier calls.
+ * The divisions and the table cells are estimated: every loop of a table adds the nominal counts of its bounds on entry.
+ * The counters are compiled in only when SHANKS_INSTRUMENTATION is defined (the CMake option of the same name),
+ * otherwise SHANKS_COUNT expands to nothing and the counters stay zero.
+ */
+
+#pragma once
+#include <cstdint> // Include the cstdint library for std::uint64_t
+
+/**
+ * @brief The counters of the work, each thread has its own ones
+ */
+struct instrumentation_counters
+{
+	std::uint64_t terms = 0; // the terms requested by the transformations and computed by S_n
+	std::uint64_t partial_sums = 0; // the partial sums computed by S_n or along with the terms
+	std::uint64_t divisions = 0; // estimated from the loop bounds, not counted per operation
+	std::uint64_t table_cells = 0; // the entries of the tables of the transformations, estimated from the loop bounds
+	std::uint64_t scratch_bytes = 0; // the memory requested for the intermediate results, the reused buffers of the thread are counted on every call
+
+	instrumentation_counters& operator+=(const instrumentation_counters& other);
+	instrumentation_counters& operator-=(const instrumentation_counters& other);
+	friend instrumentation_counters operator+(instrumentation_counters a, const instrumentation_counters& b) { return a += b; }
+	friend instrumentation_counters operator-(instrumentation_counters a, const instrumentation_counters& b) { return a -= b; }
+};
+
+inline instrumentation_counters& instrumentation_counters::operator+=(const instrumentation_counters& other)
+{
+	terms += other.terms;
+	partial_sums += other.partial_sums;
+	divisions += other.divisions;
+	table_cells += other.table_cells;
+	scratch_bytes += other.scratch_bytes;
+	return *this;
+}
+
+inline instrumentation_counters& instrumentation_counters::operator-=(const instrumentation_counters& other)
+{
+	terms -= other.terms;
+	partial_sums -= other.partial_sums;
+	divisions -= other.divisions;
+	table_cells -= other.table_cells;
+	scratch_bytes -= other.scratch_bytes;
+	return *this;
+}
+
+/**
+* @brief The counters of the calling thread, they only grow
+* @return The counters
+*/
+inline instrumentation_counters& thread_instrumentation_counters()
+{
+	thread_local instrumentation_counters counters;
+	return counters;
+}
+
+#ifdef SHANKS_INSTRUMENTATION
+constexpr bool instrumentation_enabled = true;
+#define SHANKS_COUNT(counter, amount) (thread_instrumentation_counters().counter += static_cast<std::uint64_t>(amount))
+#else
+constexpr bool instrumentation_enabled = false;
+#define SHANKS_COUNT(counter, amount) ((void)0)
+#endif
+
+/**
+* @brief Counts the work done by a call on the calling thread, e.g. instrument([&] { transform.evaluate(n, order); })
+* @tparam F The type of the call
+* @param f The call
+* @return The counters of the work done by the call, zero if the instrumentation is compiled out
+*/
+template <typename F>
+instrumentation_counters instrument(F&& f)
+{
+	const instrumentation_counters start = thread_instrumentation_counters();
+	f();
+	return thread_instrumentation_counters() - start;
+}
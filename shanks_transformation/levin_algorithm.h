@@ -0,0 +1,178 @@
+/**
+ * @file levin_algorithm.h
+ * @brief This file contains the declaration of the Levin-type transformations class.
+ */
+
+#pragma once
+
+#include "series_acceleration.h" // Include the series header
+#include <vector> // Include the vector library
+#include <algorithm> // Include the algorithm library for std::max
+
+/**
+ * @brief The remainder estimates omega_n of the Levin-type transformations.
+ * levin_u_variant: omega_n = (beta + n) * a_n, levin_t_variant: omega_n = a_n, levin_v_variant: omega_n = a_n * a_{n+1} / (a_n - a_{n+1})
+ */
+enum levin_variant_t {
+	levin_u_variant,
+	levin_t_variant,
+	levin_v_variant
+};
+
+/**
+ * @brief Levin-type transformations class template.
+ * L_k^{(n)} = N_k^{(n)} / D_k^{(n)}, where N_0^{(n)} = S_n / omega_n, D_0^{(n)} = 1 / omega_n and both of them satisfy
+ * P_k^{(n)} = P_{k-1}^{(n+1)} - (beta + n) * (beta + n + k - 1)^{k-2} / (beta + n + k)^{k-1} * P_{k-1}^{(n)}.
+ * For more information, see p. 7.2 in [E.J. Weniger, Nonlinear sequence transformations for the acceleration of convergence and the summation of divergent series]
+ * Unlike the Shanks transformation and the Epsilon Algorithm, the u and v variants accelerate the logarithmically convergent series as well.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class levin_algorithm : public series_acceleration<T, K, series_templ>
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Levin-type transformation.
+   * @param series The series class object to be accelerated
+   * @param variant The remainder estimates used by the transformation
+   * @param beta The positive shift parameter of the transformation, it is usually set to 1
+   */
+	levin_algorithm(const series_templ& series, const levin_variant_t variant = levin_u_variant, const T beta = 1);
+
+	/**
+   * @brief Levin-type transformation.
+   * Computes L_order^{(n)} from the partial sums S_n, ..., S_{n+order} with O(order) memory.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation.
+   * @return The partial sum after the transformation.
+   */
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief The number of the terms a_0, a_1, ... the transformed partial sum T_n of the given order depends on
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	K terms_required(const K n, const int order) const override;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order), every T_n is computed separately
+   * and evaluates a_n twice, in the partial sum and in the first remainder estimate
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	std::size_t sweep_terms_required(const K N, const int order) const override;
+
+	/**
+   * @brief The rough number of the arithmetic operations spent on the transformed partial sum T_n of the given order, apart from computing the terms
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of operations
+   */
+	std::size_t operations_required(const K n, const int order) const override;
+
+private:
+	/**
+   * @brief The remainder estimates used by the transformation
+   */
+	const levin_variant_t variant;
+
+	/**
+   * @brief The shift parameter of the transformation
+   */
+	const T beta;
+
+	/**
+   * @brief Computes the remainder estimate omega_n
+   * @param n The number of the term
+   * @param a_n The nth term of the series
+   * @param a_n_plus_1 The (n+1)th term of the series
+   */
+	T remainder_estimate(const K n, const T a_n, const T a_n_plus_1) const;
+};
+
+template <typename T, typename K, typename series_templ>
+levin_algorithm<T, K, series_templ>::levin_algorithm(const series_templ& series, const levin_variant_t variant, const T beta) :
+	series_acceleration<T, K, series_templ>(series), variant(variant), beta(beta)
+{
+	if (beta <= 0)
+		throw std::domain_error("the parameter beta must be positive");
+}
+
+template <typename T, typename K, typename series_templ>
+T levin_algorithm<T, K, series_templ>::remainder_estimate(const K n, const T a_n, const T a_n_plus_1) const
+{
+	switch (variant)
+	{
+	case levin_t_variant:
+		return a_n;
+	case levin_v_variant:
+		return a_n * a_n_plus_1 / (a_n - a_n_plus_1);
+	default:
+		return (beta + n) * a_n;
+	}
+}
+
+template <typename T, typename K, typename series_templ>
+T levin_algorithm<T, K, series_templ>::evaluate(const K n, const int order) const
+{
+	if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
+		return this->S_n(n);
+	else if (n == 0)
+		return DEF_UNDEFINED_SUM;
+
+	thread_local std::vector<T> numerators;
+	thread_local std::vector<T> denominators;
+	SHANKS_COUNT(scratch_bytes, 2 * (order + 1) * sizeof(T)); // counted on every call, even if the buffers of the thread are reused
+	numerators.resize(order + 1);
+	denominators.resize(order + 1);
+	SHANKS_COUNT(divisions, (variant == levin_v_variant ? 3 : 2) * (order + 1) + order * (order + 1) + 1);
+	SHANKS_COUNT(table_cells, (order + 1) * (order + 2));
+
+	T partial_sum = this->S_n(n);
+	T a_n = this->term(n);
+	for (int j = 0; j <= order; ++j)
+	{
+		const T a_n_plus_1 = this->term(n + j + 1);
+		const T omega = remainder_estimate(n + j, a_n, a_n_plus_1);
+		numerators[j] = partial_sum / omega;
+		denominators[j] = 1 / omega;
+		partial_sum += a_n_plus_1;
+		a_n = a_n_plus_1;
+	}
+
+	SHANKS_TRACE_SPAN("levin table");
+	for (int k = 1; k <= order; ++k)
+	{
+		for (int j = 0; j <= order - k; ++j)
+		{
+			const T shift = beta + n + j;
+			const T coefficient = shift / (shift + k) * series_math::pow((shift + k - 1) / (shift + k), k - 2);
+			numerators[j] = numerators[j + 1] - coefficient * numerators[j];
+			denominators[j] = denominators[j + 1] - coefficient * denominators[j];
+		}
+	}
+
+	const auto result = numerators[0] / denominators[0];
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+K levin_algorithm<T, K, series_templ>::terms_required(const K n, const int order) const
+{
+	return order == 0 ? n + 1 : n + order + 2; // omega_{n+order} needs a_{n+order+1}
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t levin_algorithm<T, K, series_templ>::sweep_terms_required(const K N, const int order) const
+{
+	return series_acceleration<T, K, series_templ>::sweep_terms_required(N, order) + (order == 0 ? 0 : static_cast<std::size_t>(std::max<K>(N, 0)));
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t levin_algorithm<T, K, series_templ>::operations_required(const K, const int order) const
+{
+	return 16 * static_cast<std::size_t>(order + 1) * (order + 1); // std::pow in the coefficients dominates
+}
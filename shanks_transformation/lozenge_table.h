@@ -0,0 +1,300 @@
+/**
+ * @file lozenge_table.h
+ * @brief This file contains the generic engine of the lozenge algorithms (epsilon, rho, theta) and their common base class
+ */
+
+#pragma once
+
+#include "series_acceleration.h" // Include the series header
+#include <vector> // Include the vector library
+#include <algorithm> // Include the algorithm library for std::min, std::max and std::fill
+
+/**
+ * @brief Streaming lozenge table.
+ * Takes the partial sums S_0, S_1, ... one at a time and keeps only the few last skewed diagonals of the table,
+ * truncated to the columns 0, ..., 2 * order. After S_N has been pushed the current diagonal holds e_c^{(N - rule::shift(c))} in column c.
+ * The diagonals lie one after another in a single buffer used as a ring, every push rewrites the oldest of them in place,
+ * so each new partial sum costs O(order) operations over contiguous memory and no allocations.
+ * The rule defines the algorithm:
+ * rule::depth is the number of diagonals the recurrence looks at (2 for the epsilon and rho algorithms, 3 for the theta algorithm),
+ * rule::shift(c) is the skew of the column c,
+ * rule::entry(c, current, previous, before_previous) computes the entry of the column c of the current diagonal,
+ * the diagonals are passed so that index -1 is the column -1, which is identically 0. Every rule divides once per entry.
+ * @tparam T The type of the partial sums, rule The recurrence of the algorithm
+ */
+template <typename T, typename rule>
+class lozenge_table
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the table.
+   * @param order The order of transformation, the table keeps the columns up to 2 * order
+   */
+	lozenge_table(const int order);
+
+	/**
+   * @brief Adds the next partial sum to the table.
+   * @param partial_sum The next partial sum of the sequence
+   * @return The updated estimate, see estimate()
+   */
+	T push(const T partial_sum);
+
+	/**
+   * @brief The current estimate of the limit, it is the entry of the highest filled even column of the current diagonal
+   * @return The current estimate
+   */
+	T estimate() const;
+
+	/**
+   * @brief The entry of the current diagonal in the given column.
+   * After the partial sums S_0, ..., S_N have been pushed it is e_c^{(N - rule::shift(c))}
+   * @param c The column, it must be at most 2 * order and rule::shift(c) must be less than size()
+   */
+	T column(const std::size_t c) const;
+
+	/**
+   * @brief The amount of the partial sums pushed so far.
+   */
+	std::size_t size() const;
+
+	/**
+   * @brief Forgets all the pushed partial sums.
+   */
+	void reset();
+
+private:
+	/**
+   * @brief The number of stored columns including the column -1
+   */
+	std::size_t stride;
+
+	/**
+   * @brief The diagonals, the one pushed at the time t starts at (t % rule::depth) * stride
+   */
+	std::vector<T> diagonals;
+
+	/**
+   * @brief The amount of the partial sums pushed so far
+   */
+	std::size_t count;
+
+	/**
+   * @brief The pointer to the column 0 of the diagonal pushed the given amount of steps ago
+   */
+	T* diagonal(const std::size_t steps_ago);
+	const T* diagonal(const std::size_t steps_ago) const;
+};
+
+template <typename T, typename rule>
+lozenge_table<T, rule>::lozenge_table(const int order) : stride(2 * order + 2), diagonals(rule::depth * stride, 0), count(0)
+{
+	SHANKS_COUNT(scratch_bytes, diagonals.size() * sizeof(T));
+}
+
+template <typename T, typename rule>
+T* lozenge_table<T, rule>::diagonal(const std::size_t steps_ago)
+{
+	return &diagonals[((count + rule::depth - steps_ago) % rule::depth) * stride + 1];
+}
+
+template <typename T, typename rule>
+const T* lozenge_table<T, rule>::diagonal(const std::size_t steps_ago) const
+{
+	return &diagonals[((count + rule::depth - steps_ago) % rule::depth) * stride + 1];
+}
+
+template <typename T, typename rule>
+T lozenge_table<T, rule>::push(const T partial_sum)
+{
+	// count is the time N of the new diagonal, it overwrites the one pushed rule::depth steps ago
+	T* current = diagonal(0);
+	const T* previous = diagonal(1);
+	const T* before_previous = diagonal(2 % rule::depth);
+	current[0] = partial_sum;
+	std::size_t c = 1;
+	for (; c + 1 < stride && rule::shift(c) <= count; ++c)
+		current[c] = rule::entry(c, current, previous, before_previous);
+	SHANKS_COUNT(divisions, c - 1);
+	SHANKS_COUNT(table_cells, c);
+	++count;
+	return estimate();
+}
+
+template <typename T, typename rule>
+T lozenge_table<T, rule>::estimate() const
+{
+	if (count == 0)
+		return DEF_UNDEFINED_SUM;
+	std::size_t c = 0;
+	while (c + 3 < stride && rule::shift(c + 2) < count)
+		c += 2;
+	return column(c);
+}
+
+template <typename T, typename rule>
+T lozenge_table<T, rule>::column(const std::size_t c) const
+{
+	return diagonal(1)[c];
+}
+
+template <typename T, typename rule>
+std::size_t lozenge_table<T, rule>::size() const
+{
+	return count;
+}
+
+template <typename T, typename rule>
+void lozenge_table<T, rule>::reset()
+{
+	std::fill(diagonals.begin(), diagonals.end(), 0);
+	count = 0;
+}
+
+/**
+ * @brief Base class of the transformations computed by a lozenge_table.
+ * The transformed partial sum T_n of the order k is e_{2k}^{(n-1)}, it depends on the partial sums S_{n-1}, ..., S_{n-1+rule::shift(2k)}.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate,
+ * rule The recurrence of the algorithm, see lozenge_table
+ */
+template <typename T, typename K, typename series_templ, typename rule>
+class lozenge_algorithm : public series_acceleration<T, K, series_templ>
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the transformation.
+   * @param series The series class object to be accelerated
+   */
+	lozenge_algorithm(const series_templ& series);
+
+	/**
+   * @brief Computes the partial sum after the transformation by pushing S_{n-1}, ..., S_{n-1+rule::shift(2 * order)} into a lozenge_table.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation.
+   * @return The partial sum after the transformation.
+   */
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N of the given order in one pass.
+   * @param N The number of terms of the last transformed partial sum.
+   * @param order The order of transformation.
+   * @return The vector of T_1, ..., T_N.
+   */
+	std::vector<T> sweep(const K N, const int order) const;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N for every order up to max_order in one pass.
+   * All the partial sums are pushed once into a single lozenge_table, after S_j its column 2k holds T_{j-rule::shift(2k)+1} of the order k,
+   * so the cost is O(N * max_order).
+   * @param N The number of terms of the last transformed partial sum.
+   * @param max_order The highest order of transformation.
+   * @return The vector whose element [order][n - 1] is T_n of the order.
+   */
+	std::vector<std::vector<T>> sweep_orders(const K N, const int max_order) const;
+
+	/**
+   * @brief The number of the terms a_0, a_1, ... the transformed partial sum T_n of the given order depends on
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	K terms_required(const K n, const int order) const override;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order), the terms are evaluated once for all n
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	std::size_t sweep_terms_required(const K N, const int order) const override;
+
+	/**
+   * @brief The rough number of the arithmetic operations spent on the transformed partial sum T_n of the given order, apart from computing the terms
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of operations
+   */
+	std::size_t operations_required(const K n, const int order) const override;
+};
+
+template <typename T, typename K, typename series_templ, typename rule>
+lozenge_algorithm<T, K, series_templ, rule>::lozenge_algorithm(const series_templ& series) : series_acceleration<T, K, series_templ>(series) {}
+
+template <typename T, typename K, typename series_templ, typename rule>
+T lozenge_algorithm<T, K, series_templ, rule>::evaluate(const K n, const int order) const
+{
+	if (n == 0)
+		return DEF_UNDEFINED_SUM;
+	else if (order == 0)
+		return this->S_n(n);
+
+	SHANKS_TRACE_SPAN("lozenge table");
+	lozenge_table<T, rule> table(order);
+	T partial_sum = this->S_n(n - 1);
+	T result = table.push(partial_sum);
+	const K last = n - 1 + static_cast<K>(rule::shift(2 * order));
+	for (K j = n; j <= last; ++j)
+	{
+		partial_sum += this->term(j);
+		result = table.push(partial_sum);
+	}
+
+	return result;
+}
+
+template <typename T, typename K, typename series_templ, typename rule>
+std::vector<T> lozenge_algorithm<T, K, series_templ, rule>::sweep(const K N, const int order) const
+{
+	return std::move(sweep_orders(N, order)[order]);
+}
+
+template <typename T, typename K, typename series_templ, typename rule>
+std::vector<std::vector<T>> lozenge_algorithm<T, K, series_templ, rule>::sweep_orders(const K N, const int max_order) const
+{
+	if (N < 0 || max_order < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<std::vector<T>> result(max_order + 1, std::vector<T>(N, DEF_UNDEFINED_SUM));
+	if (N == 0)
+		return result;
+
+	const K last = std::max<K>(N, N - 1 + static_cast<K>(rule::shift(2 * max_order))); // the order 0 needs S_N
+	std::vector<T> terms(last + 1);
+	std::vector<T> partial_sums(last + 1);
+	SHANKS_COUNT(scratch_bytes, ((max_order + 1) * N + 2 * (last + 1)) * sizeof(T)); // with the result
+	this->fill_terms_and_partial_sums(0, terms, partial_sums);
+
+	for (K n = 1; n <= N; ++n)
+		result[0][n - 1] = partial_sums[n];
+
+	SHANKS_TRACE_SPAN("lozenge table");
+	lozenge_table<T, rule> table(max_order);
+	for (K j = 0; j <= last; ++j)
+	{
+		table.push(partial_sums[j]);
+		for (int k = 1; k <= max_order && rule::shift(2 * k) <= static_cast<std::size_t>(j); ++k)
+		{
+			const K n = j - static_cast<K>(rule::shift(2 * k)) + 1;
+			if (n <= N)
+				result[k][n - 1] = table.column(2 * k);
+		}
+	}
+	return result;
+}
+
+template <typename T, typename K, typename series_templ, typename rule>
+K lozenge_algorithm<T, K, series_templ, rule>::terms_required(const K n, const int order) const
+{
+	return order == 0 ? n + 1 : n + static_cast<K>(rule::shift(2 * order));
+}
+
+template <typename T, typename K, typename series_templ, typename rule>
+std::size_t lozenge_algorithm<T, K, series_templ, rule>::sweep_terms_required(const K N, const int order) const
+{
+	return static_cast<std::size_t>(terms_required(N, order));
+}
+
+template <typename T, typename K, typename series_templ, typename rule>
+std::size_t lozenge_algorithm<T, K, series_templ, rule>::operations_required(const K, const int order) const
+{
+	return 4 * (rule::shift(2 * order) + 1) * 2 * order; // every pushed partial sum updates up to 2 * order columns
+}
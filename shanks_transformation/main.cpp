@@ -2,16 +2,22 @@
  * @file main.cpp
  * @brief testing out series_acceleration and series subclasses
  * This project contains the following:
- * 1) Series_acceleration base class in series_acceleration.h. Its subclasses are different variations of shanks transformations: shanks_transformation.h, epsilon_algorithm.h
- * 2) Series base class and its subclasses in series.h. They are the ones being accelerated
+ * 1) Series_acceleration base class in series_acceleration.h. Its subclasses are different variations of shanks transformations: shanks_transformation.h, the lozenge algorithms built on lozenge_table.h: epsilon_algorithm.h, rho_algorithm.h, theta_algorithm.h, the Levin-type transformations: levin_algorithm.h, the Richardson extrapolation: richardson_algorithm.h, the Cohen-Villegas-Zagier algorithm for the alternating series: cvz_algorithm.h and the Euler-Maclaurin summation of the series with a smooth term: euler_maclaurin.h
+ * 2) Series base class and its subclasses in series.h. They are the ones being accelerated. Besides the built-in floating point types they accept the double-double type from double_double.h
+ * 2a) The batches of series in series_batch.h: one functional series evaluated at many x at once, and their Shanks transformation and Epsilon Algorithm in batch_acceleration.h
  * 3) Testing functions in test_functions.h. Functions that can be called in main to test how series_acceleration and series_base subclasses work and cooperate.
- * 4) Framework for testing in test_framework.h
+ * 4) Framework for testing in test_framework.h, the series and the transformations are created by id in series_factory.h
+ * 5) The parallel runner of the parameter grids with a work-stealing thread pool in grid_runner.h and the parallel partial sums with very large n in parallel_sum.h
+ * 6) The benchmark of all the series and the transformations with the CSV and JSON reports and the comparison with a baseline and the Pareto frontiers of the accuracy against the cost in benchmark.h, its program is benchmark.cpp, and the probe of the hardware counters of Linux in perf_counters.h
+ * 7) The optional counters of the terms, the partial sums, the divisions, the table cells and the scratch memory in instrumentation.h, they are turned on by the CMake option SHANKS_INSTRUMENTATION
+ * 8) The timeline of the phases of the computations in trace_events.h, written as a Chrome trace if the CMake option SHANKS_TRACING is on
  * It is recommended you look up doxygen documentation on our repository https://katerina-evdokimova.github.io/shanks-university/ to convinently figure out what's everything for
  */
 #include "test_framework.h"
 
 int main(void)
 {
+	const trace_session session("shanks_trace.json"); // the timeline of the phases, only if built with SHANKS_TRACING
 	try
 	{
 		main_testing_function<long double, long long int>();
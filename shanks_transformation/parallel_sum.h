@@ -0,0 +1,86 @@
+/**
+ * @file parallel_sum.h
+ * @brief This file contains the parallel computation of the partial sums with very large n, e.g. the reference values of the slowly convergent series
+ * The terms a_0, ..., a_n are split into the chunks of a fixed length, the chunks are summed on the workers of a work_stealing_pool
+ * and their sums are combined in the same order for any number of threads, so the result is reproducible bit for bit.
+ */
+
+#pragma once
+#include <cstdint> // Include the cstdint library for std::int64_t
+#include <vector> // Include the vector library
+#include <span> // Include the span library
+#include <limits> // Include the limits library
+#include <algorithm> // Include the algorithm library for std::min
+#include "series.h"
+#include "simd_kernels.h"
+#include "grid_runner.h"
+
+/**
+* @brief Sums the values pairwise: the upper half is added to the lower half until one value is left,
+* so the rounding error grows as O(log size) instead of O(size). Every level is a loop over contiguous memory and uses the SIMD instructions.
+* @tparam T The type of the values
+* @param values The values, they are overwritten
+* @return The sum of the values
+*/
+template <typename T>
+T pairwise_sum(std::span<T> values)
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	if (values.empty())
+		return 0;
+	for (std::size_t size = values.size(); size > 1;)
+	{
+		const std::size_t half = (size + 1) / 2; // the middle value of an odd size waits for the next level
+		const std::size_t pairs = size - half;
+		std::size_t i = 0;
+		for (; i + width <= pairs; i += width)
+			(pack::load(&values[i]) + pack::load(&values[i + half])).store(&values[i]);
+		for (; i < pairs; ++i)
+			values[i] += values[i + half];
+		size = half;
+	}
+	return values[0];
+}
+
+/**
+* @brief Computes the partial sum of the first n + 1 terms a_0, ..., a_n of the series on all the workers of the pool.
+* The terms are generated with series_base::fill_terms by the blocks of parallel_sum_block terms, every block is summed pairwise,
+* and so are the sums of the blocks of a chunk and the sums of the chunks. The chunks depend only on the chunk length,
+* so the result does not depend on the number of threads. The index is 64-bit, but the terms are enumerated by K, n must fit into it.
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @param series The series, its terms are computed concurrently, so it must not have the partial sum cache turned on
+* @param n The number of the last term
+* @param pool The pool the chunks are summed on
+* @param chunk The number of the terms of a chunk, the last chunk may be shorter
+* @return The partial sum S_n
+*/
+template <typename T, typename K>
+T parallel_S_n(const series_base<T, K>& series, const std::int64_t n, work_stealing_pool& pool, const std::int64_t chunk = std::int64_t(1) << 20)
+{
+	constexpr std::int64_t parallel_sum_block = 4096;
+	if (n < 0 || chunk <= 0)
+		throw std::domain_error("negative integer in the input");
+	if (static_cast<std::uint64_t>(n) > static_cast<std::uint64_t>(std::numeric_limits<K>::max()))
+		throw std::overflow_error("n does not fit into the enumerating integer of the series");
+
+	const std::int64_t count = n / chunk + 1; // the chunks of [0, n]
+	std::vector<T> chunk_sums(count);
+	pool.run(std::vector<double>(count, 1), [&](const std::size_t c)
+	{
+		SHANKS_TRACE_SPAN("chunk");
+		const std::int64_t first = static_cast<std::int64_t>(c) * chunk;
+		const std::int64_t last = std::min(first + chunk - 1, n);
+		std::vector<T> terms(std::min(parallel_sum_block, last - first + 1));
+		std::vector<T> block_sums;
+		block_sums.reserve((last - first) / parallel_sum_block + 1);
+		for (std::int64_t i = first; i <= last; i += parallel_sum_block)
+		{
+			const auto block = std::span<T>(terms).first(std::min(parallel_sum_block, last - i + 1));
+			series.fill_terms(static_cast<K>(i), block);
+			block_sums.push_back(pairwise_sum(block));
+		}
+		chunk_sums[c] = pairwise_sum<T>(block_sums);
+	});
+	return pairwise_sum<T>(chunk_sums);
+}
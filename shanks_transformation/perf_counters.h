@@ -0,0 +1,208 @@
+/**
+ * @file perf_counters.h
+ * @brief This file contains the probe of the hardware performance counters of Linux (perf_event_open):
+ * the cycles, the instructions, the branch misses and the L1 data and the last level cache misses of a region of code.
+ * The counters the kernel, the hardware or the container does not provide are reported as unavailable, the probe never throws.
+ */
+
+#pragma once
+#include <array> // Include the array library
+#include <string> // Include the string library
+#include <cstdint> // Include the cstdint library for std::uint64_t
+#include <limits> // Include the limits library for the quiet NaN
+#if defined(__linux__)
+#include <cerrno> // Include the cerrno library for errno
+#include <cstring> // Include the cstring library for std::strerror
+#include <linux/perf_event.h> // Include the perf_event_attr structure
+#include <sys/ioctl.h> // Include the ioctl function
+#include <sys/syscall.h> // Include the syscall numbers
+#include <unistd.h> // Include the syscall, read and close functions
+#endif
+
+/**
+ * @brief The counters of the probe
+ */
+enum perf_event_id_t {
+	perf_cycles_id,
+	perf_instructions_id,
+	perf_branch_misses_id,
+	perf_l1d_misses_id,
+	perf_llc_misses_id,
+	perf_event_count
+};
+
+/**
+ * @brief The names of the counters in the reports
+ */
+inline constexpr std::array<const char*, perf_event_count> perf_event_names = { "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses" };
+
+/**
+ * @brief The values of the counters over a region, NaN for the unavailable ones.
+ * If the kernel had to share a counter with others, its value is scaled by the share of the time it ran.
+ */
+using perf_sample = std::array<double, perf_event_count>;
+
+/**
+ * @brief Probe of the hardware performance counters of the calling thread, it counts the user-space events only
+ * Usage: perf_probe probe; const auto sample = probe.measure([&] { transform.evaluate(n, order); });
+ */
+class perf_probe
+{
+public:
+	/**
+   * @brief Opens all the counters it can, the others stay unavailable
+   */
+	perf_probe();
+
+	perf_probe(const perf_probe&) = delete;
+	perf_probe& operator=(const perf_probe&) = delete;
+
+	/**
+   * @brief Closes the counters
+   */
+	~perf_probe();
+
+	/**
+   * @brief Whether the counter is available
+   * @param event The counter, see perf_event_id_t
+   */
+	bool available(const int event) const;
+
+	/**
+   * @brief Whether any counter is available
+   */
+	bool available() const;
+
+	/**
+   * @brief Why the first unavailable counter could not be opened, empty if all are available
+   */
+	const std::string& unavailable_reason() const;
+
+	/**
+   * @brief Resets and starts the counters
+   */
+	void start();
+
+	/**
+   * @brief Stops the counters
+   * @return The values of the counters since start
+   */
+	perf_sample stop();
+
+	/**
+   * @brief Counts the events of a call
+   * @tparam F The type of the call
+   * @param f The call
+   * @return The values of the counters over the call
+   */
+	template <typename F>
+	perf_sample measure(F&& f);
+
+private:
+	/**
+   * @brief The file descriptors of the counters, -1 for the unavailable ones
+   */
+	std::array<int, perf_event_count> descriptors;
+
+	std::string reason;
+};
+
+inline perf_probe::perf_probe()
+{
+	descriptors.fill(-1);
+#if defined(__linux__)
+	const auto cache_miss = [](const std::uint64_t cache) -> std::uint64_t
+	{
+		return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+	};
+	const std::array<std::array<std::uint64_t, 2>, perf_event_count> events = { {
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		{ PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_L1D) },
+		{ PERF_TYPE_HW_CACHE, cache_miss(PERF_COUNT_HW_CACHE_LL) }
+	} };
+	for (int event = 0; event < perf_event_count; ++event)
+	{
+		perf_event_attr attributes{};
+		attributes.size = sizeof(attributes);
+		attributes.type = static_cast<std::uint32_t>(events[event][0]);
+		attributes.config = events[event][1];
+		attributes.disabled = 1;
+		attributes.exclude_kernel = 1; // the user-space events are allowed with perf_event_paranoid up to 2
+		attributes.exclude_hv = 1;
+		attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		descriptors[event] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+		if (descriptors[event] < 0 && reason.empty())
+			reason = std::string(perf_event_names[event]) + ": " + std::strerror(errno);
+	}
+#else
+	reason = "perf_event_open is available only on Linux";
+#endif
+}
+
+inline perf_probe::~perf_probe()
+{
+#if defined(__linux__)
+	for (const int descriptor : descriptors)
+		if (descriptor >= 0)
+			close(descriptor);
+#endif
+}
+
+inline bool perf_probe::available(const int event) const
+{
+	return descriptors[event] >= 0;
+}
+
+inline bool perf_probe::available() const
+{
+	for (int event = 0; event < perf_event_count; ++event)
+		if (available(event))
+			return true;
+	return false;
+}
+
+inline const std::string& perf_probe::unavailable_reason() const
+{
+	return reason;
+}
+
+inline void perf_probe::start()
+{
+#if defined(__linux__)
+	for (const int descriptor : descriptors)
+		if (descriptor >= 0)
+			ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+	for (const int descriptor : descriptors)
+		if (descriptor >= 0)
+			ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+inline perf_sample perf_probe::stop()
+{
+	perf_sample sample;
+	sample.fill(std::numeric_limits<double>::quiet_NaN());
+#if defined(__linux__)
+	for (const int descriptor : descriptors)
+		if (descriptor >= 0)
+			ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+	for (int event = 0; event < perf_event_count; ++event)
+	{
+		std::uint64_t values[3]; // the value, the time enabled and the time running
+		if (descriptors[event] < 0 || read(descriptors[event], values, sizeof(values)) != sizeof(values) || values[2] == 0)
+			continue;
+		sample[event] = static_cast<double>(values[0]) * (static_cast<double>(values[1]) / static_cast<double>(values[2]));
+	}
+#endif
+	return sample;
+}
+
+template <typename F>
+perf_sample perf_probe::measure(F&& f)
+{
+	start();
+	f();
+	return stop();
+}
@@ -0,0 +1,48 @@
+/**
+ * @file rho_algorithm.h
+ * @brief This file contains the declaration of the Rho Algorithm class.
+ */
+
+#pragma once
+
+#include "lozenge_table.h" // Include the lozenge table engine
+
+/**
+ * @brief The recurrence of Wynn's Rho Algorithm for lozenge_table with the interpolation points x_n = n + 1.
+ * rho_{c}^{(n)} = rho_{c-2}^{(n+1)} + (x_{n+c} - x_n) / (rho_{c-1}^{(n+1)} - rho_{c-1}^{(n)}), the columns are not skewed.
+ * For more information, see p. 6.2 in [E.J. Weniger, Nonlinear sequence transformations for the acceleration of convergence and the summation of divergent series]
+ * @tparam T The type of the entries of the table
+ */
+template <typename T>
+struct rho_rule
+{
+	static constexpr std::size_t depth = 2;
+
+	static constexpr std::size_t shift(const std::size_t c) { return c; }
+
+	static T entry(const std::size_t c, const T* current, const T* previous, const T*)
+	{
+		return previous[c - 2] + static_cast<T>(c) / (current[c - 1] - previous[c - 1]);
+	}
+};
+
+/**
+ * @brief Rho Algorithm class template.
+ * Unlike the Epsilon Algorithm, it accelerates the logarithmically convergent series, S_n = S + c_1 / n + c_2 / n^2 + ...
+ * (e.g. pi_squared_6_minus_one_series), but it does not accelerate the alternating ones.
+ * T_n of the order k is rho_{2k}^{(n-1)}, it depends on the partial sums S_{n-1}, ..., S_{n-1+2k}.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class rho_algorithm : public lozenge_algorithm<T, K, series_templ, rho_rule<T>>
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Rho Algorithm.
+   * @param series The series class object to be accelerated
+   */
+	rho_algorithm(const series_templ& series);
+};
+
+template <typename T, typename K, typename series_templ>
+rho_algorithm<T, K, series_templ>::rho_algorithm(const series_templ& series) : lozenge_algorithm<T, K, series_templ, rho_rule<T>>(series) {}
@@ -0,0 +1,195 @@
+/**
+ * @file richardson_algorithm.h
+ * @brief This file contains the declaration of the Richardson extrapolation class.
+ */
+
+#pragma once
+
+#include "series_acceleration.h" // Include the series header
+#include <vector> // Include the vector library
+#include <limits> // Include the limits library for the largest value of K
+#include <stdexcept> // Include the stdexcept library for std::overflow_error
+
+/**
+ * @brief Incremental Richardson tableau.
+ * Takes the values A(h), A(h / r), A(h / r^2), ... one at a time, where A(h) = A + c_1 * h + c_2 * h^2 + ...,
+ * and keeps only the last row of the Neville-style tableau R_{j,m} = R_{j,m-1} + (R_{j,m-1} - R_{j-1,m-1}) / (r^m - 1).
+ * Every new value adds one level of the extrapolation at the cost of O(levels) operations.
+ * @tparam T The type of the values
+ */
+template <typename T>
+class richardson_tableau
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the tableau.
+   * @param max_level The highest level of the extrapolation, the tableau keeps the columns up to max_level
+   * @param ratio The ratio r of the consecutive steps h, it must be greater than 1
+   */
+	richardson_tableau(const int max_level, const T ratio = 2);
+
+	/**
+   * @brief Adds the next value A(h / r^j) to the tableau.
+   * @param value The value computed with the next step
+   * @return The updated estimate, see estimate()
+   */
+	T push(const T value);
+
+	/**
+   * @brief The current estimate of A, it is the entry of the highest level in the last row.
+   */
+	T estimate() const;
+
+	/**
+   * @brief The amount of the values pushed so far.
+   */
+	std::size_t size() const;
+
+private:
+	/**
+   * @brief The last row of the tableau, row[m] = R_{j,m}
+   */
+	std::vector<T> row;
+
+	/**
+   * @brief factors[m] = r^m - 1
+   */
+	std::vector<T> factors;
+
+	/**
+   * @brief The amount of the values pushed so far
+   */
+	std::size_t count;
+};
+
+template <typename T>
+richardson_tableau<T>::richardson_tableau(const int max_level, const T ratio) : row(max_level + 1, 0), factors(max_level + 1, 0), count(0)
+{
+	if (ratio <= 1)
+		throw std::domain_error("the ratio of the steps must be greater than 1");
+	SHANKS_COUNT(scratch_bytes, 2 * row.size() * sizeof(T));
+	T power = 1;
+	for (auto& factor : factors)
+	{
+		factor = power - 1;
+		power *= ratio;
+	}
+}
+
+template <typename T>
+T richardson_tableau<T>::push(const T value)
+{
+	const std::size_t levels = std::min(count + 1, row.size());
+	T old_m_minus_1 = row[0];
+	row[0] = value;
+	SHANKS_COUNT(divisions, levels - 1);
+	SHANKS_COUNT(table_cells, levels);
+	for (std::size_t m = 1; m < levels; ++m)
+	{
+		const T old_m = row[m];
+		row[m] = row[m - 1] + (row[m - 1] - old_m_minus_1) / factors[m];
+		old_m_minus_1 = old_m;
+	}
+	++count;
+	return estimate();
+}
+
+template <typename T>
+T richardson_tableau<T>::estimate() const
+{
+	if (count == 0)
+		return DEF_UNDEFINED_SUM;
+	return row[std::min(count, row.size()) - 1];
+}
+
+template <typename T>
+std::size_t richardson_tableau<T>::size() const
+{
+	return count;
+}
+
+/**
+ * @brief Richardson extrapolation class template.
+ * It is meant for the series whose partial sums converge like a polynomial tail, S_n = S + c_1 / n + c_2 / n^2 + ...
+ * (e.g. pi_squared_6_minus_one_series, one_twelfth_series), which the Shanks transformation and the Epsilon Algorithm accelerate poorly.
+ * The partial sums are taken at the geometrically spaced n, 2n, 4n, ..., 2^order * n and extrapolated to 1 / n -> 0.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class richardson_algorithm : public series_acceleration<T, K, series_templ>
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Richardson extrapolation.
+   * @param series The series class object to be accelerated
+   */
+	richardson_algorithm(const series_templ& series);
+
+	/**
+   * @brief Richardson extrapolation.
+   * Computes the extrapolation of the partial sums S_n, S_{2n}, ..., S_{2^order * n}.
+   * Every next order costs only one new partial sum, which is reached by adding the terms to the previous one.
+   * @param n The number of terms in the first partial sum.
+   * @param order The order of transformation.
+   * @return The partial sum after the transformation.
+   * @throws std::overflow_error if 2^order * n does not fit into K
+   */
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief The number of the terms a_0, a_1, ... the transformed partial sum T_n of the given order depends on
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of terms, the largest value of K if it does not fit into K
+   */
+	K terms_required(const K n, const int order) const override;
+
+private:
+	/**
+   * @brief Whether the last partial sum S_{2^order * n} and its number of terms fit into K
+   * @param n The number of terms in the first partial sum
+   * @param order The order of the transformation
+   */
+	static bool fits(const K n, const int order);
+};
+
+template <typename T, typename K, typename series_templ>
+richardson_algorithm<T, K, series_templ>::richardson_algorithm(const series_templ& series) : series_acceleration<T, K, series_templ>(series) {}
+
+template <typename T, typename K, typename series_templ>
+T richardson_algorithm<T, K, series_templ>::evaluate(const K n, const int order) const
+{
+	if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
+		return this->S_n(n);
+	else if (n == 0)
+		return DEF_UNDEFINED_SUM;
+
+	if (!fits(n, order))
+		throw std::overflow_error("2^order * n does not fit into the enumerating integer");
+
+	SHANKS_TRACE_SPAN("richardson tableau");
+	richardson_tableau<T> tableau(order);
+	K i = n;
+	T partial_sum = this->S_n(i);
+	T result = tableau.push(partial_sum);
+	for (int j = 1; j <= order; ++j)
+	{
+		for (const K next = i * 2; i < next;)
+			partial_sum += this->term(++i);
+		result = tableau.push(partial_sum);
+	}
+
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+K richardson_algorithm<T, K, series_templ>::terms_required(const K n, const int order) const
+{
+	return fits(n, order) ? (n << order) + 1 : std::numeric_limits<K>::max();
+}
+
+template <typename T, typename K, typename series_templ>
+bool richardson_algorithm<T, K, series_templ>::fits(const K n, const int order)
+{
+	return order < std::numeric_limits<K>::digits && n <= (std::numeric_limits<K>::max() - 1) >> order;
+}
@@ -38,10 +38,17 @@
 #pragma once
 #define NO_X_GIVEN 0
 #define NO_SERIES_EXPRESSION_GIVEN 0
+#include <cmath>
+#include <string>
 #include <numbers>
 #include <limits>
-
-
+#include <vector>
+#include <span>
+#include <stdexcept>
+#include "simd_kernels.h"
+#include "taylor_jet.h"
+#include "instrumentation.h"
+#include "series_math.h"
 
 /**
 * @brief Abstract class for series
@@ -52,6 +59,10 @@ template <typename T, typename K>
 class series_base
 {
 public:
+	/**
+	* @brief The type of the terms and the partial sums of the series
+	*/
+	using value_type = T;
 
 	/**
 	* @brief Parameterized constructor to initialize the series with function argument
@@ -68,13 +79,72 @@ public:
 	*/
 	[[nodiscard]] constexpr T S_n(K n) const;
 
+	/**
+	* @brief Turns on (or off) memoization of the partial sums
+	* When turned on, S_n stores every partial sum it has computed, so the table grows incrementally
+	* and repeated S_n calls for already reached n cost O(1). The cache is not thread-safe.
+	* @param enable Whether the partial sums should be memoized
+	*/
+	void enable_partial_sum_cache(bool enable = true);
+
+	/**
+	* @brief Whether S_n memoizes the partial sums, see enable_partial_sum_cache
+	*/
+	[[nodiscard]] bool is_partial_sum_cache_enabled() const;
+
 	/**
 	* @brief Computes nth term of the series
+	* Checks n, calls term and checks the term with check_term, so the series do not repeat the checks
 	* @authors Bolshakov M.P.
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const = 0;
+	[[nodiscard]] constexpr T operator()(K n) const;
+
+	/**
+	* @brief Computes nth term of the series without checking n
+	* It is the hot path used by S_n and the transformations, which check their input once. n must be non-negative
+	* @param n The number of the term
+	* @return nth term of the series
+	*/
+	[[nodiscard]] constexpr virtual T term(K n) const = 0;
+
+	virtual ~series_base() = default;
+
+	/**
+	* @brief Computes (n+1)th term of the series from the nth one
+	* Series with an analytic ratio a_{n+1} / a_n override it, so that consecutive terms cost O(1) each
+	* and no std::pow or factorial is evaluated. By default it falls back to term(n + 1).
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ..., a_{n + terms.size() - 1}
+	* By default the terms are generated with next_term. Hot series override it with vectorized kernels from simd_kernels.h
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
+
+	/**
+	* @brief Fills the spans with consecutive terms a_n, a_{n+1}, ... and partial sums S_n, S_{n+1}, ... in one call
+	* @param n The number of the first term
+	* @param terms The span to be filled with the terms
+	* @param partial_sums The span of the same size to be filled with the partial sums
+	*/
+	void fill_terms_and_partial_sums(K n, std::span<T> terms, std::span<T> partial_sums) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function f of a real argument: a_n = f(n), or a_n = (-1)^n f(n) for the alternating series
+	* The argument is a taylor_jet x + h, so the result carries the derivatives of f at x as well, see euler_maclaurin_algorithm.
+	* Only the series whose term is a closed-form function of n (e.g. a rational function) override it, by default f is not available
+	* @param x The argument, it is replaced with f(x)
+	* @return Whether the series provides f
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 
 	/**
 	* @brief x getter
@@ -96,6 +166,14 @@ protected:
 	*/
 	series_base(T x, T sum);
 
+	/**
+	* @brief Checks the nth term computed by operator(), by default it accepts any term
+	* The series whose terms may overflow override it to throw std::overflow_error. term, S_n, fill_terms and so the transformations do not call it
+	* @param n The number of the term
+	* @param a_n The nth term of the series
+	*/
+	constexpr virtual void check_term(K n, T a_n) const;
+
 	/**
 	* @brief function series argument
 	* It's set to 0 by default
@@ -115,7 +193,7 @@ protected:
 	* @authors Bolshakov M.P.
 	* @return n!
 	*/
-	[[nodiscard]] constexpr static const K fact(K n);
+	[[nodiscard]] constexpr static const T fact(K n);
 
 	/**
 	* @brief binomial coefficient C^n_k
@@ -131,33 +209,211 @@ protected:
 	* @return (-1)^n
 	*/
 	[[nodiscard]] constexpr static const T minus_one_raised_to_power_n(K n);
+
+	/**
+	* @brief Computes partial sum of the first n terms of the given series
+	* It is shared by series_base::S_n and series_crtp::S_n: when series_type is a final series class
+	* the calls of its terms are resolved statically
+	* @tparam series_type The type of the series whose terms are summed
+	* @param series The series whose terms are summed, it is *this
+	* @param n The amount of terms in the partial sum
+	* @return Partial sum of the first n terms
+	*/
+	template <typename series_type>
+	[[nodiscard]] constexpr T partial_sum(const series_type& series, K n) const;
+
+private:
+	/**
+	* @brief whether S_n memoizes the partial sums
+	*/
+	bool partial_sum_cache_enabled = false;
+
+	/**
+	* @brief memoized partial sums, partial_sums[i] = S_n(i)
+	*/
+	mutable std::vector<T> partial_sums;
+
+	/**
+	* @brief the last term added to the memoized partial sums
+	*/
+	mutable T last_term = 0;
 };
 
+/**
+* @brief Sequential generator of the terms of a series
+* Each step uses series_base::next_term, so generating the first N terms costs O(N) operations
+* @authors Bolshakov M.P.
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class term_generator
+{
+public:
+	/**
+	* @brief Parameterized constructor to start the generation from the nth term
+	* @param series The series whose terms are generated
+	* @param n The number of the first generated term
+	*/
+	term_generator(const series_base<T, K>& series, K n = 0);
+
+	/**
+	* @brief current term getter
+	*/
+	[[nodiscard]] constexpr T operator*() const;
+
+	/**
+	* @brief number of the current term getter
+	*/
+	[[nodiscard]] constexpr K index() const;
+
+	/**
+	* @brief Moves the generator to the next term
+	*/
+	constexpr term_generator& operator++();
+
+private:
+	const series_base<T, K>& series;
+	K n;
+	T a_n;
+};
+
+template <typename T, typename K>
+term_generator<T, K>::term_generator(const series_base<T, K>& series, K n) : series(series), n(n), a_n(series(n)) {}
+
+template <typename T, typename K>
+constexpr T term_generator<T, K>::operator*() const
+{
+	return a_n;
+}
+
+template <typename T, typename K>
+constexpr K term_generator<T, K>::index() const
+{
+	return n;
+}
+
+template <typename T, typename K>
+constexpr term_generator<T, K>& term_generator<T, K>::operator++()
+{
+	a_n = series.next_term(n, a_n);
+	++n;
+	return *this;
+}
+
 template <typename T, typename K>
 series_base<T, K>::series_base(T x) : x(x), sum(0)
 {
-	static_assert(std::is_floating_point_v<T>);
+	static_assert(std::numeric_limits<T>::is_specialized && !std::numeric_limits<T>::is_integer); // float, double, long double or double_double
 	static_assert(std::numeric_limits<K>::is_integer);
 }
 
 template <typename T, typename K>
 series_base<T, K>::series_base(T x, T sum) : x(x), sum(sum)
 {
-	static_assert(std::is_floating_point_v<T>);
+	static_assert(std::numeric_limits<T>::is_specialized && !std::numeric_limits<T>::is_integer); // float, double, long double or double_double
 	static_assert(std::numeric_limits<K>::is_integer);
 }
 
 template <typename T, typename K>
 constexpr T series_base<T, K>::S_n(K n) const
+{
+	return partial_sum(*this, n);
+}
+
+template <typename T, typename K>
+template <typename series_type>
+constexpr T series_base<T, K>::partial_sum(const series_type& series, K n) const
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	T sum = operator()(n);
-	for (int i = 0; i < n; ++i)
-		sum += operator()(i);
+	SHANKS_COUNT(partial_sums, 1);
+	if (partial_sum_cache_enabled)
+	{
+		SHANKS_COUNT(terms, n < static_cast<K>(partial_sums.size()) ? 0 : n + 1 - static_cast<K>(partial_sums.size()));
+		if (partial_sums.empty())
+		{
+			last_term = series.term(0);
+			partial_sums.push_back(last_term);
+		}
+		for (K i = static_cast<K>(partial_sums.size()); i <= n; ++i)
+		{
+			last_term = series.next_term(i - 1, last_term);
+			partial_sums.push_back(partial_sums.back() + last_term);
+		}
+		return partial_sums[n];
+	}
+	SHANKS_COUNT(terms, n + 1);
+	T sum = series.term(n);
+	for (K i = 0; i < n; ++i)
+		sum += series.term(i);
 	return sum;
 }
 
+template <typename T, typename K>
+constexpr T series_base<T, K>::operator()(K n) const
+{
+	if (n < 0)
+		throw std::domain_error("negative integer in the input");
+	const T a_n = term(n);
+	check_term(n, a_n);
+	return a_n;
+}
+
+template <typename T, typename K>
+constexpr void series_base<T, K>::check_term(K, T) const {}
+
+template <typename T, typename K>
+constexpr T series_base<T, K>::next_term(K n, T) const
+{
+	return term(n + 1);
+}
+
+template <typename T, typename K>
+void series_base<T, K>::fill_terms(K n, std::span<T> terms) const
+{
+	if (terms.empty())
+		return;
+	if (n < 0)
+		throw std::domain_error("negative integer in the input");
+	terms[0] = term(n);
+	for (std::size_t i = 1; i < terms.size(); ++i)
+		terms[i] = next_term(static_cast<K>(n + i - 1), terms[i - 1]);
+}
+
+template <typename T, typename K>
+void series_base<T, K>::fill_terms_and_partial_sums(K n, std::span<T> terms, std::span<T> partial_sums) const
+{
+	if (terms.size() != partial_sums.size())
+		throw std::domain_error("the spans for the terms and the partial sums differ in size");
+	fill_terms(n, terms);
+	T sum = n ? S_n(n - 1) : 0;
+	for (std::size_t i = 0; i < terms.size(); ++i)
+	{
+		sum += terms[i];
+		partial_sums[i] = sum;
+	}
+}
+
+template <typename T, typename K>
+bool series_base<T, K>::smooth_term(taylor_jet<T>&) const
+{
+	return false;
+}
+
+template <typename T, typename K>
+void series_base<T, K>::enable_partial_sum_cache(bool enable)
+{
+	partial_sum_cache_enabled = enable;
+	if (!enable)
+		partial_sums.clear();
+}
+
+template <typename T, typename K>
+bool series_base<T, K>::is_partial_sum_cache_enabled() const
+{
+	return partial_sum_cache_enabled;
+}
+
 template <typename T, typename K>
 constexpr const T series_base<T, K>::get_x() const
 {
@@ -171,12 +427,12 @@ constexpr const T series_base<T, K>::get_sum() const
 }
 
 template <typename T, typename K>
-constexpr const K series_base<T,K>::fact(K n)
+constexpr const T series_base<T,K>::fact(K n)
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	int f = 1;
-	for (int i = 2; i <= n; ++i)
+	T f = 1;
+	for (K i = 2; i <= n; ++i)
 		f *= i;
 	return f;
 }
@@ -196,13 +452,42 @@ constexpr const T series_base<T, K>::minus_one_raised_to_power_n(K n)
 	return n % 2 ? -1 : 1;
 }
 
+/**
+* @brief Static-polymorphism layer between series_base and the concrete series
+* The concrete series are final classes derived from series_crtp<series, T, K>. A pointer to a concrete series can be used as
+* series_templ of the transformations: its terms and partial sums are then resolved at compile time and can be inlined into
+* the transformation loops. series_base stays as the type-erased interface for the code that chooses the series at runtime.
+* @tparam derived The concrete series class, T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename derived, typename T, typename K>
+class series_crtp : public series_base<T, K>
+{
+public:
+	/**
+	* @brief Computes partial sum of the first n terms without the virtual dispatch
+	* @authors Bolshakov M.P.
+	* @param n The amount of terms in the partial sum
+	* @return Partial sum of the first n terms
+	*/
+	[[nodiscard]] constexpr T S_n(K n) const;
+
+protected:
+	using series_base<T, K>::series_base;
+};
+
+template <typename derived, typename T, typename K>
+constexpr T series_crtp<derived, T, K>::S_n(K n) const
+{
+	return this->partial_sum(static_cast<const derived&>(*this), n);
+}
+
 /**
 * @brief Maclaurin series of exponent
 * @authors Bolshakov M.P.
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class exp_series : public series_base<T, K>
+class exp_series final : public series_crtp<exp_series<T, K>, T, K>
 {
 public:
 	exp_series() = delete;
@@ -220,18 +505,46 @@ public:
 	* @param n The number of the term
 	* @return nth term of the Maclaurin series of the exponent
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x / (n + 1)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the exponent kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-exp_series<T, K>::exp_series(T x) : series_base<T,K>(x, std::exp(x)) {}
+exp_series<T, K>::exp_series(T x) : series_crtp<exp_series<T, K>, T, K>(x, series_math::exp(x)) {}
 
 template <typename T, typename K>
-constexpr T exp_series<T, K>::operator()(K n) const
+constexpr T exp_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, n) / this->fact(n);
+	return series_math::pow(this->x, n) / this->fact(n);
+}
+
+template <typename T, typename K>
+constexpr T exp_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x / (k + 1);
+}
+
+template <typename T, typename K>
+void exp_series<T, K>::fill_terms(K n, std::span<T> terms) const
+{
+	if (terms.empty())
+		return;
+	exp_kernel(this->x, (*this)(n), static_cast<T>(n), terms);
 }
 
 /**
@@ -240,7 +553,7 @@ constexpr T exp_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class cos_series : public series_base<T, K>
+class cos_series final : public series_crtp<cos_series<T, K>, T, K>
 {
 public:
 	cos_series() = delete;
@@ -258,18 +571,31 @@ public:
 	* @param n The number of the term
 	* @return nth term of the Maclaurin series of the cosine functions
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = -x^2 / ((2n + 1)(2n + 2))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-cos_series<T, K>::cos_series(T x) : series_base<T, K>(x, std::cos(x)) {}
+cos_series<T, K>::cos_series(T x) : series_crtp<cos_series<T, K>, T, K>(x, series_math::cos(x)) {}
 
 template <typename T, typename K>
-constexpr T cos_series<T, K>::operator()(K n) const
+constexpr T cos_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return series_base<T,K>::minus_one_raised_to_power_n(n) * std::pow(this->x, 2 * n) / this->fact(2 * n);
+	return series_base<T,K>::minus_one_raised_to_power_n(n) * series_math::pow(this->x, 2 * n) / this->fact(2 * n);
+}
+
+template <typename T, typename K>
+constexpr T cos_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return -a_n * this->x * this->x / ((2 * k + 1) * (2 * k + 2));
 }
 
 /**
@@ -278,7 +604,7 @@ constexpr T cos_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class sin_series : public series_base<T, K>
+class sin_series final : public series_crtp<sin_series<T, K>, T, K>
 {
 public:
 	sin_series() = delete;
@@ -296,18 +622,31 @@ public:
 	* @param n The number of the term
 	* @return nth term of the Maclaurin series of the sine functions
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = -x^2 / ((2n + 2)(2n + 3))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-sin_series<T, K>::sin_series(T x) : series_base<T, K>(x, std::sin(x)) {}
+sin_series<T, K>::sin_series(T x) : series_crtp<sin_series<T, K>, T, K>(x, series_math::sin(x)) {}
 
 template <typename T, typename K>
-constexpr T sin_series<T, K>::operator()(K n) const
+constexpr T sin_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return series_base<T, K>::minus_one_raised_to_power_n(n) * std::pow(this->x, 2 * n + 1) / this->fact(2 * n + 1);
+	return series_base<T, K>::minus_one_raised_to_power_n(n) * series_math::pow(this->x, 2 * n + 1) / this->fact(2 * n + 1);
+}
+
+template <typename T, typename K>
+constexpr T sin_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return -a_n * this->x * this->x / ((2 * k + 2) * (2 * k + 3));
 }
 
 /**
@@ -316,7 +655,7 @@ constexpr T sin_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class cosh_series : public series_base<T, K>
+class cosh_series final : public series_crtp<cosh_series<T, K>, T, K>
 {
 public:
 	cosh_series() = delete;
@@ -334,18 +673,31 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x^2 / ((2n + 1)(2n + 2))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-cosh_series<T, K>::cosh_series(T x) : series_base<T, K>(x, std::cosh(x)) {}
+cosh_series<T, K>::cosh_series(T x) : series_crtp<cosh_series<T, K>, T, K>(x, series_math::cosh(x)) {}
 
 template <typename T, typename K>
-constexpr T cosh_series<T, K>::operator()(K n) const
+constexpr T cosh_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, 2 * n) / this->fact(2 * n);
+	return series_math::pow(this->x, 2 * n) / this->fact(2 * n);
+}
+
+template <typename T, typename K>
+constexpr T cosh_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x * this->x / ((2 * k + 1) * (2 * k + 2));
 }
 
 /**
@@ -354,7 +706,7 @@ constexpr T cosh_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class sinh_series : public series_base<T, K>
+class sinh_series final : public series_crtp<sinh_series<T, K>, T, K>
 {
 public:
 	sinh_series() = delete;
@@ -372,18 +724,31 @@ public:
 	* @param n The number of the term
 	* @return nth term of the Maclaurin series of the sinh functions
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x^2 / ((2n + 2)(2n + 3))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-sinh_series<T, K>::sinh_series(T x) : series_base<T, K>(x, std::sinh(x)) {}
+sinh_series<T, K>::sinh_series(T x) : series_crtp<sinh_series<T, K>, T, K>(x, series_math::sinh(x)) {}
 
 template <typename T, typename K>
-constexpr T sinh_series<T, K>::operator()(K n) const
+constexpr T sinh_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, 2 * n + 1) / this->fact(2 * n + 1);
+	return series_math::pow(this->x, 2 * n + 1) / this->fact(2 * n + 1);
+}
+
+template <typename T, typename K>
+constexpr T sinh_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x * this->x / ((2 * k + 2) * (2 * k + 3));
 }
 
 /**
@@ -392,7 +757,7 @@ constexpr T sinh_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class bin_series : public series_base<T, K>
+class bin_series final : public series_crtp<bin_series<T, K>, T, K>
 {
 	using series_base<T, K>::binomial_coefficient;
 
@@ -412,7 +777,15 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x * (alpha - n) / (n + 1)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 private:
 
 	/**
@@ -423,18 +796,23 @@ private:
 };
 
 template <typename T, typename K>
-bin_series<T, K>::bin_series(T x, T alpha) : series_base<T, K>(x, std::pow(1 + x, alpha)), alpha(alpha)
+bin_series<T, K>::bin_series(T x, T alpha) : series_crtp<bin_series<T, K>, T, K>(x, series_math::pow(1 + x, alpha)), alpha(alpha)
 {
-	if (std::abs(x) > 1)
+	if (series_math::abs(x) > 1)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T bin_series<T, K>::operator()(K n) const
+constexpr T bin_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return binomial_coefficient(alpha, n) * std::pow(this->x, n);
+	return binomial_coefficient(alpha, n) * series_math::pow(this->x, n);
+}
+
+template <typename T, typename K>
+constexpr T bin_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x * (alpha - k) / (k + 1);
 }
 
 /**
@@ -443,7 +821,7 @@ constexpr T bin_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class four_arctan_series : public series_base<T, K>
+class four_arctan_series final : public series_crtp<four_arctan_series<T, K>, T, K>
 {
 public:
 	four_arctan_series() = delete;
@@ -461,22 +839,35 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = -x^2 * (2n + 1) / (2n + 3)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-four_arctan_series<T, K>::four_arctan_series(T x) : series_base<T, K>(x, 4*std::atan(x))
+four_arctan_series<T, K>::four_arctan_series(T x) : series_crtp<four_arctan_series<T, K>, T, K>(x, 4*series_math::atan(x))
 {
-	if (std::abs(x) > 1)
-		throw std::domain_error("the arctan series diverge at x = " + std::to_string(x));
+	if (series_math::abs(x) > 1)
+		throw std::domain_error("the arctan series diverge at x = " + series_math::to_string(x));
 }
 
 template <typename T, typename K>
-constexpr T four_arctan_series<T, K>::operator()(K n) const
+constexpr T four_arctan_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return 4 * series_base<T, K>::minus_one_raised_to_power_n(n) * std::pow(this->x, 2 * n + 1) / (2 * n + 1);
+	return 4 * series_base<T, K>::minus_one_raised_to_power_n(n) * series_math::pow(this->x, 2 * n + 1) / (2 * n + 1);
+}
+
+template <typename T, typename K>
+constexpr T four_arctan_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return -a_n * this->x * this->x * (2 * k + 1) / (2 * k + 3);
 }
 
 /**
@@ -485,7 +876,7 @@ constexpr T four_arctan_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class ln1mx_series : public series_base<T, K>
+class ln1mx_series final : public series_crtp<ln1mx_series<T, K>, T, K>
 {
 public:
 	ln1mx_series() = delete;
@@ -503,22 +894,35 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x * (n + 1) / (n + 2)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-ln1mx_series<T, K>::ln1mx_series(T x) : series_base<T, K>(x, -std::log(1 - x))
+ln1mx_series<T, K>::ln1mx_series(T x) : series_crtp<ln1mx_series<T, K>, T, K>(x, -series_math::log(1 - x))
 {
-	if (std::abs(this->x) > 1 || this->x == 1)
+	if (series_math::abs(this->x) > 1 || this->x == 1)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T ln1mx_series<T, K>::operator()(K n) const
+constexpr T ln1mx_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, n + 1) / (n + 1);
+	return series_math::pow(this->x, n + 1) / (n + 1);
+}
+
+template <typename T, typename K>
+constexpr T ln1mx_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x * (k + 1) / (k + 2);
 }
 
 /**
@@ -527,7 +931,7 @@ constexpr T ln1mx_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class mean_sinh_sin_series : public series_base<T, K>
+class mean_sinh_sin_series final : public series_crtp<mean_sinh_sin_series<T, K>, T, K>
 {
 public:
 	mean_sinh_sin_series() = delete;
@@ -545,18 +949,31 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x^4 / ((4n + 2)(4n + 3)(4n + 4)(4n + 5))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-mean_sinh_sin_series<T, K>::mean_sinh_sin_series(T x) : series_base<T, K>(x, 0.5 * (std::sinh(x) + std::sin(x))) {}
+mean_sinh_sin_series<T, K>::mean_sinh_sin_series(T x) : series_crtp<mean_sinh_sin_series<T, K>, T, K>(x, 0.5 * (series_math::sinh(x) + series_math::sin(x))) {}
 
 template <typename T, typename K>
-constexpr T mean_sinh_sin_series<T, K>::operator()(K n) const
+constexpr T mean_sinh_sin_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, 4 * n + 1) / this->fact(4 * n + 1);
+	return series_math::pow(this->x, 4 * n + 1) / this->fact(4 * n + 1);
+}
+
+template <typename T, typename K>
+constexpr T mean_sinh_sin_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * series_math::pow(this->x, 4) / ((4 * k + 2) * (4 * k + 3) * (4 * k + 4) * (4 * k + 5));
 }
 
 /**
@@ -565,7 +982,7 @@ constexpr T mean_sinh_sin_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class exp_squared_erf_series : public series_base<T, K>
+class exp_squared_erf_series final : public series_crtp<exp_squared_erf_series<T, K>, T, K>
 {
 public:
 	exp_squared_erf_series() = delete;
@@ -583,21 +1000,47 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x^2 / (n + 1.5)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
+
+protected:
+	/**
+	* @brief Checks that the nth term computed by operator() is finite
+	* @param n The number of the term
+	* @param a_n The nth term of the series
+	* @throws std::overflow_error if the term is not finite
+	*/
+	constexpr virtual void check_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-exp_squared_erf_series<T, K>::exp_squared_erf_series(T x) : series_base<T, K>(x, std::exp(x * x)* std::erf(x)) {}
+exp_squared_erf_series<T, K>::exp_squared_erf_series(T x) : series_crtp<exp_squared_erf_series<T, K>, T, K>(x, series_math::exp(x * x)* series_math::erf(x)) {}
 
 template <typename T, typename K>
-constexpr T exp_squared_erf_series<T, K>::operator()(K n) const
+constexpr T exp_squared_erf_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	const auto result = std::pow(this->x, 2 * n + 1) / std::tgamma(n+1.5);
-	if (!isfinite(result))
+	return series_math::pow(this->x, 2 * n + 1) / series_math::tgamma(n + static_cast<T>(1.5));
+}
+
+template <typename T, typename K>
+constexpr T exp_squared_erf_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x * this->x / (k + 1.5);
+}
+
+template <typename T, typename K>
+constexpr void exp_squared_erf_series<T, K>::check_term(K, T a_n) const
+{
+	if (!series_math::isfinite(a_n))
 		throw std::overflow_error("operator() is too big");
-	return result;
 }
 
 /**
@@ -606,7 +1049,7 @@ constexpr T exp_squared_erf_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class xmb_Jb_two_series : public series_base<T, K>
+class xmb_Jb_two_series final : public series_crtp<xmb_Jb_two_series<T, K>, T, K>
 {
 public:
 	xmb_Jb_two_series() = delete;
@@ -624,7 +1067,15 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = -x^2 / ((n + 1)(n + 1 + b))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 private:
 
 	/**
@@ -635,14 +1086,19 @@ private:
 };
 
 template <typename T, typename K>
-xmb_Jb_two_series<T, K>::xmb_Jb_two_series(T x, K b) : series_base<T, K>(x, std::pow(x, -b)* std::cyl_bessel_j(b, 2 * x)), mu(b) {}
+xmb_Jb_two_series<T, K>::xmb_Jb_two_series(T x, K b) : series_crtp<xmb_Jb_two_series<T, K>, T, K>(x, series_math::pow(x, -b)* series_math::cyl_bessel_j(b, 2 * x)), mu(b) {}
 
 template <typename T, typename K>
-constexpr T xmb_Jb_two_series<T, K>::operator()(K n) const
+constexpr T xmb_Jb_two_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return series_base<T, K>::minus_one_raised_to_power_n(n) * std::pow(this->x, 2 * n) / (this->fact(n) * this->fact(n + this->mu));
+	return series_base<T, K>::minus_one_raised_to_power_n(n) * series_math::pow(this->x, 2 * n) / (this->fact(n) * this->fact(n + this->mu));
+}
+
+template <typename T, typename K>
+constexpr T xmb_Jb_two_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return -a_n * this->x * this->x / ((k + 1) * (k + 1 + this->mu));
 }
 
 /**
@@ -651,7 +1107,7 @@ constexpr T xmb_Jb_two_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class half_asin_two_x_series : public series_base<T, K>
+class half_asin_two_x_series final : public series_crtp<half_asin_two_x_series<T, K>, T, K>
 {
 public:
 	half_asin_two_x_series() = delete;
@@ -669,23 +1125,36 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = 2x^2 * (2n + 1)^2 / ((n + 1)(2n + 3))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-half_asin_two_x_series<T, K>::half_asin_two_x_series(T x) : series_base<T, K>(x, 0.5 * std::asin(2 * x))
+half_asin_two_x_series<T, K>::half_asin_two_x_series(T x) : series_crtp<half_asin_two_x_series<T, K>, T, K>(x, 0.5 * series_math::asin(2 * x))
 {
-	if (std::abs(this->x) > 0.5)
+	if (series_math::abs(this->x) > 0.5)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T half_asin_two_x_series<T, K>::operator()(K n) const
+constexpr T half_asin_two_x_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
 	const auto _fact_n = this->fact(n);
-	return this->fact(2 * n) * std::pow(this->x, 2 * n) / (_fact_n * _fact_n * (2 * n + 1)); // p. 566 typo
+	return this->fact(2 * n) * series_math::pow(this->x, 2 * n) / (_fact_n * _fact_n * (2 * n + 1)); // p. 566 typo
+}
+
+template <typename T, typename K>
+constexpr T half_asin_two_x_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * 2 * this->x * this->x * (2 * k + 1) * (2 * k + 1) / ((k + 1) * (2 * k + 3));
 }
 
 /**
@@ -694,7 +1163,7 @@ constexpr T half_asin_two_x_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class inverse_1mx_series : public series_base<T, K>
+class inverse_1mx_series final : public series_crtp<inverse_1mx_series<T, K>, T, K>
 {
 public:
 	inverse_1mx_series() = delete;
@@ -712,22 +1181,49 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the geometric progression kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-inverse_1mx_series<T, K>::inverse_1mx_series(T x) : series_base<T, K>(x, 1 / (1 - x))
+inverse_1mx_series<T, K>::inverse_1mx_series(T x) : series_crtp<inverse_1mx_series<T, K>, T, K>(x, 1 / (1 - x))
 {
-	if (std::abs(this->x) >= 1)
+	if (series_math::abs(this->x) >= 1)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T inverse_1mx_series<T, K>::operator()(K n) const
+constexpr T inverse_1mx_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, n);
+	return series_math::pow(this->x, n);
+}
+
+template <typename T, typename K>
+constexpr T inverse_1mx_series<T, K>::next_term(K, T a_n) const
+{
+	return a_n * this->x;
+}
+
+template <typename T, typename K>
+void inverse_1mx_series<T, K>::fill_terms(K n, std::span<T> terms) const
+{
+	if (terms.empty())
+		return;
+	geometric_kernel((*this)(n), this->x, terms);
 }
 
 /**
@@ -736,7 +1232,7 @@ constexpr T inverse_1mx_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class x_1mx_squared_series : public series_base<T, K>
+class x_1mx_squared_series final : public series_crtp<x_1mx_squared_series<T, K>, T, K>
 {
 public:
 	x_1mx_squared_series() = delete;
@@ -754,22 +1250,37 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x * (n + 1) / n
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-x_1mx_squared_series<T, K>::x_1mx_squared_series(T x) : series_base<T, K>(x, x / std::fma(x, x - 1, 1 - x))
+x_1mx_squared_series<T, K>::x_1mx_squared_series(T x) : series_crtp<x_1mx_squared_series<T, K>, T, K>(x, x / series_math::fma(x, x - 1, 1 - x))
 {
-	if (std::abs(this->x) > 1 || this->x == 1)
+	if (series_math::abs(this->x) > 1 || this->x == 1)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T x_1mx_squared_series<T, K>::operator()(K n) const
+constexpr T x_1mx_squared_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return std::pow(this->x, n) * n;
+	return series_math::pow(this->x, n) * n;
+}
+
+template <typename T, typename K>
+constexpr T x_1mx_squared_series<T, K>::next_term(K n, T a_n) const
+{
+	if (n == 0)
+		return this->x;
+	const T k = n;
+	return a_n * this->x * (k + 1) / k;
 }
 
 /**
@@ -778,7 +1289,7 @@ constexpr T x_1mx_squared_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class erf_series : public series_base<T, K>
+class erf_series final : public series_crtp<erf_series<T, K>, T, K>
 {
 public:
 	erf_series() = delete;
@@ -796,21 +1307,34 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = -x^2 * (2n + 1) / ((n + 1)(2n + 3))
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-erf_series<T, K>::erf_series(T x) : series_base<T, K>(x, std::sqrt(std::numbers::pi) * std::erf(x) * 0.5) 
+erf_series<T, K>::erf_series(T x) : series_crtp<erf_series<T, K>, T, K>(x, series_math::sqrt(std::numbers::pi_v<T>) * series_math::erf(x) * 0.5) 
 {
 
 }
 
 template <typename T, typename K>
-constexpr T erf_series<T, K>::operator()(K n) const
+constexpr T erf_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return series_base<T, K>::minus_one_raised_to_power_n(n) * std::pow(this->x, 2 * n + 1) / (this->fact(n) * (2 * n + 1));
+	return series_base<T, K>::minus_one_raised_to_power_n(n) * series_math::pow(this->x, 2 * n + 1) / (this->fact(n) * (2 * n + 1));
+}
+
+template <typename T, typename K>
+constexpr T erf_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return -a_n * this->x * this->x * (2 * k + 1) / ((k + 1) * (2 * k + 3));
 }
 
 /**
@@ -819,7 +1343,7 @@ constexpr T erf_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class m_fact_1mx_mp1_inverse_series : public series_base<T, K>
+class m_fact_1mx_mp1_inverse_series final : public series_crtp<m_fact_1mx_mp1_inverse_series<T, K>, T, K>
 {
 public:
 	m_fact_1mx_mp1_inverse_series() = delete;
@@ -837,7 +1361,15 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = x * (m + n + 1) / (n + 1)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 private:
 
 	/**
@@ -848,20 +1380,25 @@ private:
 };
 
 template <typename T, typename K>
-m_fact_1mx_mp1_inverse_series<T, K>::m_fact_1mx_mp1_inverse_series(T x, K m) : series_base<T, K>(x, this->fact(m) / pow(1 - x, m + 1)), m(m) 
+m_fact_1mx_mp1_inverse_series<T, K>::m_fact_1mx_mp1_inverse_series(T x, K m) : series_crtp<m_fact_1mx_mp1_inverse_series<T, K>, T, K>(x, this->fact(m) / series_math::pow(1 - x, m + 1)), m(m) 
 {
-	if (!isfinite(series_base<T,K>::sum)) // sum = this->fact(m) / pow(1 - x, m + 1))
+	if (!series_math::isfinite(series_base<T,K>::sum)) // sum = this->fact(m) / pow(1 - x, m + 1))
 		throw std::overflow_error("sum is too big");
-	if (std::abs(this->x) >= 1) // p. 564 typo
+	if (series_math::abs(this->x) >= 1) // p. 564 typo
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T m_fact_1mx_mp1_inverse_series<T, K>::operator()(K n) const
+constexpr T m_fact_1mx_mp1_inverse_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return this->fact(this->m + n) * std::pow(this->x, n) / this->fact(n);
+	return this->fact(this->m + n) * series_math::pow(this->x, n) / this->fact(n);
+}
+
+template <typename T, typename K>
+constexpr T m_fact_1mx_mp1_inverse_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * this->x * (this->m + k + 1) / (k + 1);
 }
 
 /**
@@ -870,7 +1407,7 @@ constexpr T m_fact_1mx_mp1_inverse_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class inverse_sqrt_1m4x_series : public series_base<T, K>
+class inverse_sqrt_1m4x_series final : public series_crtp<inverse_sqrt_1m4x_series<T, K>, T, K>
 {
 public:
 	inverse_sqrt_1m4x_series() = delete;
@@ -888,23 +1425,36 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Computes the (n+1)th term of the series from the nth one, a_{n+1} / a_n = 2x * (2n + 1) / (n + 1)
+	* @param n The number of the known term
+	* @param a_n The nth term of the series
+	* @return (n+1)th term of the series
+	*/
+	[[nodiscard]] constexpr virtual T next_term(K n, T a_n) const;
 };
 
 template <typename T, typename K>
-inverse_sqrt_1m4x_series<T, K>::inverse_sqrt_1m4x_series(T x) : series_base<T, K>(x, std::pow(std::fma(-4, x, 1), -0.5)) 
+inverse_sqrt_1m4x_series<T, K>::inverse_sqrt_1m4x_series(T x) : series_crtp<inverse_sqrt_1m4x_series<T, K>, T, K>(x, series_math::pow(series_math::fma(-4, x, 1), -0.5)) 
 {
-	if (std::abs(this->x) > 0.25 || this->x == 0.25)
+	if (series_math::abs(this->x) > 0.25 || this->x == 0.25)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T inverse_sqrt_1m4x_series<T, K>::operator()(K n) const
+constexpr T inverse_sqrt_1m4x_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
 	const auto _fact_n = this->fact(n);
-	return this->fact(2 * n) * pow(this->x, n) / (_fact_n * _fact_n);
+	return this->fact(2 * n) * series_math::pow(this->x, n) / (_fact_n * _fact_n);
+}
+
+template <typename T, typename K>
+constexpr T inverse_sqrt_1m4x_series<T, K>::next_term(K n, T a_n) const
+{
+	const T k = n;
+	return a_n * 2 * this->x * (2 * k + 1) / (k + 1);
 }
 
 /**	
@@ -913,7 +1463,7 @@ constexpr T inverse_sqrt_1m4x_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class one_twelfth_3x2_pi2_series : public series_base<T, K>
+class one_twelfth_3x2_pi2_series final : public series_crtp<one_twelfth_3x2_pi2_series<T, K>, T, K>
 {
 public:
 	one_twelfth_3x2_pi2_series() = delete;
@@ -931,22 +1481,20 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
 };
 
 template <typename T, typename K>
-one_twelfth_3x2_pi2_series<T, K>::one_twelfth_3x2_pi2_series(T x) : series_base<T, K>(x, std::fma(0.25*x, x, -std::numbers::pi* std::numbers::pi / 12))
+one_twelfth_3x2_pi2_series<T, K>::one_twelfth_3x2_pi2_series(T x) : series_crtp<one_twelfth_3x2_pi2_series<T, K>, T, K>(x, series_math::fma(0.25*x, x, -std::numbers::pi_v<T>* std::numbers::pi_v<T> / 12))
 {
-	if (std::abs(this->x) > std::numbers::pi)
+	if (series_math::abs(this->x) > std::numbers::pi_v<T>)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T one_twelfth_3x2_pi2_series<T, K>::operator()(K n) const
+constexpr T one_twelfth_3x2_pi2_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) * std::cos(n * this->x) / (n * n) : 0;
+	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) * series_math::cos(n * this->x) / (n * n) : 0;
 }
 
 /**
@@ -955,7 +1503,7 @@ constexpr T one_twelfth_3x2_pi2_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class x_twelfth_x2_pi2_series : public series_base<T, K>
+class x_twelfth_x2_pi2_series final : public series_crtp<x_twelfth_x2_pi2_series<T, K>, T, K>
 {
 public:
 	x_twelfth_x2_pi2_series() = delete;
@@ -973,22 +1521,20 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
 };
 
 template <typename T, typename K>
-x_twelfth_x2_pi2_series<T, K>::x_twelfth_x2_pi2_series(T x) : series_base<T, K>(x, std::fma(x / 12, (x + std::numbers::pi) * (x - std::numbers::pi), -std::fma(x + std::numbers::pi, x - std::numbers::pi, (x + std::numbers::pi) * (x - std::numbers::pi))))
+x_twelfth_x2_pi2_series<T, K>::x_twelfth_x2_pi2_series(T x) : series_crtp<x_twelfth_x2_pi2_series<T, K>, T, K>(x, series_math::fma(x / 12, (x + std::numbers::pi_v<T>) * (x - std::numbers::pi_v<T>), -series_math::fma(x + std::numbers::pi_v<T>, x - std::numbers::pi_v<T>, (x + std::numbers::pi_v<T>) * (x - std::numbers::pi_v<T>))))
 {
-	if (std::abs(this->x) > std::numbers::pi)
+	if (series_math::abs(this->x) > std::numbers::pi_v<T>)
 		throw std::domain_error("series diverge");
 }
 
 template <typename T, typename K>
-constexpr T x_twelfth_x2_pi2_series<T, K>::operator()(K n) const
+constexpr T x_twelfth_x2_pi2_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) * std::sin(n * this->x) / (n * n * n) : 0;
+	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) * series_math::sin(n * this->x) / (n * n * n) : 0;
 }
 
 /**
@@ -997,7 +1543,7 @@ constexpr T x_twelfth_x2_pi2_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class ln2_series : public series_base<T, K>
+class ln2_series final : public series_crtp<ln2_series<T, K>, T, K>
 {
 public:
 	ln2_series();
@@ -1008,18 +1554,53 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the reciprocal product kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-ln2_series<T, K>::ln2_series() : series_base<T, K>(0, std::log(2)) {}
+ln2_series<T, K>::ln2_series() : series_crtp<ln2_series<T, K>, T, K>(0, series_math::log(static_cast<T>(2))) {}
 
 template <typename T, typename K>
-constexpr T ln2_series<T, K>::operator()(K n) const
+constexpr T ln2_series<T, K>::term(K n) const
+{
+	return n ? static_cast<T>(-series_base<T, K>::minus_one_raised_to_power_n(n)) / n : 0;
+}
+
+template <typename T, typename K>
+bool ln2_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = -1 / x;
+	return true;
+}
+
+template <typename T, typename K>
+void ln2_series<T, K>::fill_terms(K n, std::span<T> terms) const
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	return n ? static_cast<T>(-series_base<T, K>::minus_one_raised_to_power_n(n)) / n : 0;
+	if (terms.empty())
+		return;
+	if (n == 0) // a_0 = 0, the kernel would divide by zero
+	{
+		terms[0] = 0;
+		terms = terms.subspan(1);
+		++n;
+	}
+	reciprocal_product_kernel<T, K, 1>(-1, true, { { { 1, 0 } } }, n, terms);
 }
 
 /**
@@ -1028,7 +1609,7 @@ constexpr T ln2_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class one_series : public series_base<T, K>
+class one_series final : public series_crtp<one_series<T, K>, T, K>
 {
 public:
 	/**
@@ -1043,18 +1624,30 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 };
 
 template <typename T, typename K>
-one_series<T, K>::one_series() : series_base<T, K>(0, 1) {}
+one_series<T, K>::one_series() : series_crtp<one_series<T, K>, T, K>(0, 1) {}
 
 template <typename T, typename K>
-constexpr T one_series<T, K>::operator()(K n) const
+constexpr T one_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return n ? 1.0 / (n*n + n) : 0;
+	return n ? static_cast<T>(1) / (n*n + n) : 0;
+}
+
+template <typename T, typename K>
+bool one_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (x * x + x);
+	return true;
 }
 
 /**
@@ -1063,7 +1656,7 @@ constexpr T one_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class minus_one_quarter_series : public series_base<T, K>
+class minus_one_quarter_series final : public series_crtp<minus_one_quarter_series<T, K>, T, K>
 {
 public:
 	minus_one_quarter_series();
@@ -1074,27 +1667,39 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 };
 
 template <typename T, typename K>
-minus_one_quarter_series<T, K>::minus_one_quarter_series() : series_base<T, K>(0, -0.25) {}
+minus_one_quarter_series<T, K>::minus_one_quarter_series() : series_crtp<minus_one_quarter_series<T, K>, T, K>(0, -0.25) {}
 
 template <typename T, typename K>
-constexpr T minus_one_quarter_series<T, K>::operator()(K n) const
+constexpr T minus_one_quarter_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
 	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) / (n * n + 2 * n) : 0;
 }
 
+template <typename T, typename K>
+bool minus_one_quarter_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (x * x + 2 * x);
+	return true;
+}
+
 /**
 * @brief Numerical series representation of pi/3
 * @authors Pashkov B.B.
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class pi_3_series : public series_base<T, K>
+class pi_3_series final : public series_crtp<pi_3_series<T, K>, T, K>
 {
 public:
 	pi_3_series();
@@ -1105,18 +1710,45 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the reciprocal product kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-pi_3_series<T, K>::pi_3_series() : series_base<T, K>(0, std::numbers::pi / 3) {}
+pi_3_series<T, K>::pi_3_series() : series_crtp<pi_3_series<T, K>, T, K>(0, std::numbers::pi_v<T> / 3) {}
+
+template <typename T, typename K>
+constexpr T pi_3_series<T, K>::term(K n) const
+{
+	return static_cast<T>(1) / ((n + 1) * (2 * n + 1) * (4 * n + 1));
+}
+
+template <typename T, typename K>
+bool pi_3_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / ((x + 1) * (2 * x + 1) * (4 * x + 1));
+	return true;
+}
 
 template <typename T, typename K>
-constexpr T pi_3_series<T, K>::operator()(K n) const
+void pi_3_series<T, K>::fill_terms(K n, std::span<T> terms) const
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	return 1.0 / ((n + 1) * (2 * n + 1) * (4 * n + 1));
+	reciprocal_product_kernel<T, K, 3>(1, false, { { { 1, 1 }, { 2, 1 }, { 4, 1 } } }, n, terms);
 }
 
 /**
@@ -1125,7 +1757,7 @@ constexpr T pi_3_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class pi_4_series : public series_base<T, K>
+class pi_4_series final : public series_crtp<pi_4_series<T, K>, T, K>
 {
 public:
 	pi_4_series();
@@ -1136,18 +1768,45 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the reciprocal product kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-pi_4_series<T, K>::pi_4_series() : series_base<T, K>(0, 0.25 * std::numbers::pi) {}
+pi_4_series<T, K>::pi_4_series() : series_crtp<pi_4_series<T, K>, T, K>(0, 0.25 * std::numbers::pi_v<T>) {}
+
+template <typename T, typename K>
+constexpr T pi_4_series<T, K>::term(K n) const
+{
+	return series_base<T, K>::minus_one_raised_to_power_n(n) / (2 * n + 1);
+}
+
+template <typename T, typename K>
+bool pi_4_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (2 * x + 1);
+	return true;
+}
 
 template <typename T, typename K>
-constexpr T pi_4_series<T, K>::operator()(K n) const
+void pi_4_series<T, K>::fill_terms(K n, std::span<T> terms) const
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	return series_base<T, K>::minus_one_raised_to_power_n(n) / (2 * n + 1);
+	reciprocal_product_kernel<T, K, 1>(1, true, { { { 2, 1 } } }, n, terms);
 }
 
 /**
@@ -1156,7 +1815,7 @@ constexpr T pi_4_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class pi_squared_6_minus_one_series : public series_base<T, K>
+class pi_squared_6_minus_one_series final : public series_crtp<pi_squared_6_minus_one_series<T, K>, T, K>
 {
 public:
 	pi_squared_6_minus_one_series();
@@ -1167,18 +1826,30 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 };
 
 template <typename T, typename K>
-pi_squared_6_minus_one_series<T, K>::pi_squared_6_minus_one_series() : series_base<T, K>(0, std::fma(std::numbers::pi / 6, std::numbers::pi, -1)) {}
+pi_squared_6_minus_one_series<T, K>::pi_squared_6_minus_one_series() : series_crtp<pi_squared_6_minus_one_series<T, K>, T, K>(0, series_math::fma(std::numbers::pi_v<T> / 6, std::numbers::pi_v<T>, -1)) {}
 
 template <typename T, typename K>
-constexpr T pi_squared_6_minus_one_series<T, K>::operator()(K n) const
+constexpr T pi_squared_6_minus_one_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return n ? 1.0 / (n * n * (n + 1)) : 0;
+	return n ? static_cast<T>(1) / (n * n * (n + 1)) : 0;
+}
+
+template <typename T, typename K>
+bool pi_squared_6_minus_one_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (x * x * (x + 1));
+	return true;
 }
 
 /**
@@ -1187,7 +1858,7 @@ constexpr T pi_squared_6_minus_one_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class three_minus_pi_series : public series_base<T, K>
+class three_minus_pi_series final : public series_crtp<three_minus_pi_series<T, K>, T, K>
 {
 public:
 	three_minus_pi_series();
@@ -1198,27 +1869,39 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 };
 
 template <typename T, typename K>
-three_minus_pi_series<T, K>::three_minus_pi_series() : series_base<T, K>(0, 3 - std::numbers::pi) {}
+three_minus_pi_series<T, K>::three_minus_pi_series() : series_crtp<three_minus_pi_series<T, K>, T, K>(0, 3 - std::numbers::pi_v<T>) {}
 
 template <typename T, typename K>
-constexpr T three_minus_pi_series<T, K>::operator()(K n) const
+constexpr T three_minus_pi_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
 	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) / (n * (n + 1) * (2 * n + 1)) : 0;
 }
 
+template <typename T, typename K>
+bool three_minus_pi_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (x * (x + 1) * (2 * x + 1));
+	return true;
+}
+
 /**
 * @brief Numerical series representation of 1/12
 * @authors Pashkov B.B.
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class one_twelfth_series : public series_base<T, K>
+class one_twelfth_series final : public series_crtp<one_twelfth_series<T, K>, T, K>
 {
 public:
 	one_twelfth_series();
@@ -1229,18 +1912,45 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the reciprocal product kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-one_twelfth_series<T, K>::one_twelfth_series() : series_base<T, K>(0, 1 / 12) {}
+one_twelfth_series<T, K>::one_twelfth_series() : series_crtp<one_twelfth_series<T, K>, T, K>(0, static_cast<T>(1) / 12) {}
+
+template <typename T, typename K>
+constexpr T one_twelfth_series<T, K>::term(K n) const
+{
+	return static_cast<T>(1) / ((2 * n + 1) * (2 * n + 3) * (2 * n + 5));
+}
 
 template <typename T, typename K>
-constexpr T one_twelfth_series<T, K>::operator()(K n) const
+bool one_twelfth_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / ((2 * x + 1) * (2 * x + 3) * (2 * x + 5));
+	return true;
+}
+
+template <typename T, typename K>
+void one_twelfth_series<T, K>::fill_terms(K n, std::span<T> terms) const
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	return 1.0 / ((2 * n + 1) * (2 * n + 3) * (2 * n + 5));
+	reciprocal_product_kernel<T, K, 3>(1, false, { { { 2, 1 }, { 2, 3 }, { 2, 5 } } }, n, terms);
 }
 
 /**
@@ -1249,7 +1959,7 @@ constexpr T one_twelfth_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class eighth_pi_m_one_third_series : public series_base<T, K>
+class eighth_pi_m_one_third_series final : public series_crtp<eighth_pi_m_one_third_series<T, K>, T, K>
 {
 public:
 	eighth_pi_m_one_third_series();
@@ -1260,18 +1970,45 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
+
+	/**
+	* @brief Fills the span with consecutive terms a_n, a_{n+1}, ... using the reciprocal product kernel
+	* @param n The number of the first term
+	* @param terms The span to be filled
+	*/
+	virtual void fill_terms(K n, std::span<T> terms) const;
 };
 
 template <typename T, typename K>
-eighth_pi_m_one_third_series<T, K>::eighth_pi_m_one_third_series() : series_base<T, K>(0, std::numbers::pi / 8 - 1 / 3) {}
+eighth_pi_m_one_third_series<T, K>::eighth_pi_m_one_third_series() : series_crtp<eighth_pi_m_one_third_series<T, K>, T, K>(0, std::numbers::pi_v<T> / 8 - static_cast<T>(1) / 3) {}
+
+template <typename T, typename K>
+constexpr T eighth_pi_m_one_third_series<T, K>::term(K n) const
+{
+	return series_base<T, K>::minus_one_raised_to_power_n(n) / ((2 * n + 1) * (2 * n + 3) * (2 * n + 5));
+}
+
+template <typename T, typename K>
+bool eighth_pi_m_one_third_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / ((2 * x + 1) * (2 * x + 3) * (2 * x + 5));
+	return true;
+}
 
 template <typename T, typename K>
-constexpr T eighth_pi_m_one_third_series<T, K>::operator()(K n) const
+void eighth_pi_m_one_third_series<T, K>::fill_terms(K n, std::span<T> terms) const
 {
 	if (n < 0)
 		throw std::domain_error("negative integer in the input");
-	return series_base<T, K>::minus_one_raised_to_power_n(n) / ((2 * n + 1) * (2 * n + 3) * (2 * n + 5));
+	reciprocal_product_kernel<T, K, 3>(1, true, { { { 2, 1 }, { 2, 3 }, { 2, 5 } } }, n, terms);
 }
 
 /**
@@ -1280,7 +2017,7 @@ constexpr T eighth_pi_m_one_third_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class one_third_pi_squared_m_nine_series : public series_base<T, K>
+class one_third_pi_squared_m_nine_series final : public series_crtp<one_third_pi_squared_m_nine_series<T, K>, T, K>
 {
 public:
 	one_third_pi_squared_m_nine_series();
@@ -1291,18 +2028,30 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 };
 
 template <typename T, typename K>
-one_third_pi_squared_m_nine_series<T, K>::one_third_pi_squared_m_nine_series() : series_base<T, K>(0, std::fma(std::numbers::pi, std::numbers::pi, -9) / 3) {}
+one_third_pi_squared_m_nine_series<T, K>::one_third_pi_squared_m_nine_series() : series_crtp<one_third_pi_squared_m_nine_series<T, K>, T, K>(0, series_math::fma(std::numbers::pi_v<T>, std::numbers::pi_v<T>, -9) / 3) {}
 
 template <typename T, typename K>
-constexpr T one_third_pi_squared_m_nine_series<T, K>::operator()(K n) const
+constexpr T one_third_pi_squared_m_nine_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return n ? 1.0 / (n * n * (n + 1) * (n + 1)) : 0;
+	return n ? static_cast<T>(1) / (n * n * (n + 1) * (n + 1)) : 0;
+}
+
+template <typename T, typename K>
+bool one_third_pi_squared_m_nine_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (x * x * (x + 1) * (x + 1));
+	return true;
 }
 
 /**
@@ -1311,7 +2060,7 @@ constexpr T one_third_pi_squared_m_nine_series<T, K>::operator()(K n) const
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class four_ln2_m_3_series : public series_base<T, K>
+class four_ln2_m_3_series final : public series_crtp<four_ln2_m_3_series<T, K>, T, K>
 {
 public:
 	four_ln2_m_3_series();
@@ -1322,27 +2071,39 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
+
+	/**
+	* @brief Evaluates the term as a smooth function of a real argument, see series_base::smooth_term
+	* @param x The argument, it is replaced with the term
+	* @return true
+	*/
+	virtual bool smooth_term(taylor_jet<T>& x) const;
 };
 
 template <typename T, typename K>
-four_ln2_m_3_series<T, K>::four_ln2_m_3_series() : series_base<T, K>(0, std::fma(4, std::log(2), -3)) {}
+four_ln2_m_3_series<T, K>::four_ln2_m_3_series() : series_crtp<four_ln2_m_3_series<T, K>, T, K>(0, series_math::fma(4, series_math::log(static_cast<T>(2)), -3)) {}
 
 template <typename T, typename K>
-constexpr T four_ln2_m_3_series<T, K>::operator()(K n) const
+constexpr T four_ln2_m_3_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
 	return n ? series_base<T, K>::minus_one_raised_to_power_n(n) / (n * n * (n + 1) * (n + 1)) : 0;
 }
 
+template <typename T, typename K>
+bool four_ln2_m_3_series<T, K>::smooth_term(taylor_jet<T>& x) const
+{
+	x = 1 / (x * x * (x + 1) * (x + 1));
+	return true;
+}
+
 /**
 * @brief Maclaurin series of exp(-cos(x)) * sin(sin(x))
 * @authors Pashkov B.B.
 * @tparam T The type of the elements in the series, K The type of enumerating integer
 */
 template <typename T, typename K>
-class exp_m_cos_x_sinsin_x_series : public series_base<T, K>
+class exp_m_cos_x_sinsin_x_series final : public series_crtp<exp_m_cos_x_sinsin_x_series<T, K>, T, K>
 {
 public:
 	exp_m_cos_x_sinsin_x_series() = delete;
@@ -1360,16 +2121,14 @@ public:
 	* @param n The number of the term
 	* @return nth term of the series
 	*/
-	[[nodiscard]] constexpr virtual T operator()(K n) const;
+	[[nodiscard]] constexpr virtual T term(K n) const;
 };
 
 template <typename T, typename K>
-exp_m_cos_x_sinsin_x_series<T, K>::exp_m_cos_x_sinsin_x_series(T x) : series_base<T, K>(x, std::exp(-std::cos(x)) * std::sin(std::sin(x))) {}
+exp_m_cos_x_sinsin_x_series<T, K>::exp_m_cos_x_sinsin_x_series(T x) : series_crtp<exp_m_cos_x_sinsin_x_series<T, K>, T, K>(x, series_math::exp(-series_math::cos(x)) * series_math::sin(series_math::sin(x))) {}
 
 template <typename T, typename K>
-constexpr T exp_m_cos_x_sinsin_x_series<T, K>::operator()(K n) const
+constexpr T exp_m_cos_x_sinsin_x_series<T, K>::term(K n) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	return this->minus_one_raised_to_power_n(n) * std::sin(n * this->x) / this->fact(n);
+	return this->minus_one_raised_to_power_n(n) * series_math::sin(n * this->x) / this->fact(n);
 }
\ No newline at end of file
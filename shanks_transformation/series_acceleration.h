@@ -8,14 +8,77 @@
 #define DEF_NO_TRANSFORM 0
 /** @brief Default value for an unspecified series */
 #define NO_SERIES_GIVEN 0
+/** @brief Default value for the transformed partial sum that is not defined, e.g. for n = 0 */
+#define DEF_UNDEFINED_SUM 0
 
 #include <functional>  // Include the functional library for std::function
 #include <iostream>   // Include the iostream library for I/O functionalities
 #include <exception>  // Include the exception library for std::exception
 #include <math.h>     // Include the math library for mathematical functions
 #include <string>	  // Include the library which contains the string class
+#include <vector>     // Include the vector library
+#include <limits>     // Include the limits library for the quiet NaN
+#include <span>       // Include the span library
+#include <type_traits> // Include the type_traits library for std::is_same_v
+#include <stdexcept>  // Include the stdexcept library for std::domain_error and std::overflow_error
+#include <algorithm>  // Include the algorithm library for std::copy_n
 #include "series.h"
+#include "trace_events.h"
 
+/**
+ * @brief The status of a transformed partial sum computed by the non-throwing API
+ * ok: the value is finite, non_finite: the transformation divided by zero or overflowed, the value is NaN or Inf,
+ * invalid_argument: n or order is negative or the series threw std::domain_error, the value is NaN,
+ * overflow: the series threw std::overflow_error, e.g. its terms are too big, the value is NaN,
+ * failure: any other exception, e.g. std::bad_alloc, the value is NaN
+ */
+enum class eval_status {
+	ok,
+	non_finite,
+	invalid_argument,
+	overflow,
+	failure
+};
+
+/**
+* @brief The status of the exception being handled, it is called inside a catch block
+* @return invalid_argument for std::domain_error, overflow for std::overflow_error and failure for any other exception
+*/
+inline eval_status current_exception_status() noexcept
+{
+	try
+	{
+		throw;
+	}
+	catch (const std::domain_error&)
+	{
+		return eval_status::invalid_argument;
+	}
+	catch (const std::overflow_error&)
+	{
+		return eval_status::overflow;
+	}
+	catch (...)
+	{
+		return eval_status::failure;
+	}
+}
+
+/**
+ * @brief The value of a transformed partial sum together with its status
+ * @tparam T The type of the value
+ */
+template <typename T>
+struct eval_result
+{
+	T value;
+	eval_status status;
+
+	/**
+   * @brief Whether the value is usable
+   */
+	constexpr bool ok() const { return status == eval_status::ok; }
+};
 
 /**
  * @brief Base class series_acceleration
@@ -24,6 +87,10 @@
  * The class implementation provides everything needed for construction of an arbitrary series up to n terms and printing out the partial sum,
  * the partial sum after transformation is used, and the difference between the latter and the former.
  * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ * series_templ is a pointer to the series: either series_base<T, K>* or a pointer to a concrete series (e.g. exp_series<T, K>*),
+ * in the latter case the terms are called without the virtual dispatch.
+ * The series may use a narrower type than T (e.g. series_base<double, K>* with T = long double): its terms are then generated in the fast type
+ * and widened to T, and the partial sums and the tables of the transformation are accumulated in T
  */
 template <typename T, typename K, typename series_templ>
 class series_acceleration
@@ -43,20 +110,165 @@ public:
 	constexpr void print_info() const;
 
 	/**
-   * @brief Virtual operator() that returns the partial sum after transformation of the series
+   * @brief Returns the partial sum after transformation of the series
+   * It is a thin wrapper over evaluate
    * @authors Bolshakov M.P., Pashkov B.B.
    * @param n The number of terms
    * @param order The order of the transformation
    * @return The transformed partial sum
+   * @throws std::domain_error if n or order is negative, std::overflow_error if the transformed partial sum is not finite
    */
-	virtual T operator()(const K n, const int order) const = 0;
+	T operator()(const K n, const int order) const;
+
+	/**
+   * @brief Returns the partial sum after transformation of the series without throwing
+   * The exceptions of evaluate are mapped to the statuses, see current_exception_status
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The transformed partial sum and its status
+   */
+	eval_result<T> try_eval(const K n, const int order) const noexcept;
+
+	/**
+   * @brief Computes the partial sum after transformation of the series
+   * This is what the transformations implement. It neither checks the input nor throws on the division by zero:
+   * the caller guarantees n >= 0 and order >= 0, and a non-finite result is returned as it is
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The transformed partial sum, possibly NaN or Inf
+   */
+	virtual T evaluate(const K n, const int order) const = 0;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N of the given order in one pass
+   * The default implementation calls evaluate for every n, the transformations override it to share their tables between the calls.
+   * The values the transformation fails to compute are left non-finite
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The vector of T_1, ..., T_N
+   */
+	virtual std::vector<T> sweep(const K N, const int order) const;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N for every order from 0 to max_order
+   * The default implementation calls sweep for every order
+   * @param N The number of terms of the last transformed partial sum
+   * @param max_order The highest order of the transformation
+   * @return The vector whose element [order][n - 1] is the transformed partial sum T_n of the order
+   */
+	virtual std::vector<std::vector<T>> sweep_orders(const K N, const int max_order) const;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N of the given order in one pass without throwing
+   * If sweep throws, all the values are NaN with the status of the exception, see current_exception_status
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The vector of T_1, ..., T_N with their statuses, it is empty if N or order is negative or there is no memory for it
+   */
+	std::vector<eval_result<T>> try_sweep(const K N, const int order) const noexcept;
+
+	/**
+   * @brief The number of the terms a_0, a_1, ... the transformed partial sum T_n of the given order depends on
+   * It is the main part of the cost of the transformation, the default implementation assumes the partial sums up to S_{n+order}
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	virtual K terms_required(const K n, const int order) const;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order) with the partial sum cache of the series off
+   * The default sweep evaluates every T_n separately, so the default implementation is the sum of terms_required(n, order) over n = 1, ..., N.
+   * The transformations whose sweep shares the terms between all n override it with terms_required(N, order)
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	virtual std::size_t sweep_terms_required(const K N, const int order) const;
+
+	/**
+   * @brief The rough number of the arithmetic operations spent on the transformed partial sum T_n of the given order, apart from computing the terms
+   * The default implementation assumes a triangular table with order levels
+   * @param n The number of terms
+   * @param order The order of the transformation
+   * @return The number of operations
+   */
+	virtual std::size_t operations_required(const K n, const int order) const;
+
+	/**
+   * @brief Turns on or off the cache of the terms and the partial sums in T, so the later calls reuse the terms computed by the earlier ones
+   * The terms are kept from a_0 up as term, S_n and fill_terms_and_partial_sums compute them. Turning the cache off frees it.
+   * Like the partial sum cache of the series, it is not thread-safe, see sum_until_converged
+   * @param enable Whether the terms are cached
+   */
+	void enable_term_cache(const bool enable = true);
+
+	/**
+   * @brief Whether the terms and the partial sums are cached, see enable_term_cache
+   */
+	[[nodiscard]] bool is_term_cache_enabled() const;
+
+	virtual ~series_acceleration() = default;
 
 protected:
+	/**
+   * @brief The type of the terms of the series, it may be narrower than T
+   */
+	using term_type = typename std::remove_cvref_t<decltype(*std::declval<const series_templ&>())>::value_type;
+
 	/**
    * @brief Series whose convergence is being accelerated
    * @authors Bolshakov M.P.
    */
 	series_templ series;
+
+	/**
+   * @brief The nth term of the series widened to T, n is not checked
+   * If the terms are cached, the cached one is returned and the next one is appended to the cache
+   * @param n The number of the term
+   */
+	T term(const K n) const;
+
+	/**
+   * @brief The partial sum S_n of the series accumulated in T
+   * If the terms are cached, the cache is extended up to a_n. Otherwise, if the series uses T itself, it is series->S_n(n) with its cache,
+   * and if the series uses a narrower type, the widened terms are summed up
+   * @authors Bolshakov M.P.
+   * @param n The amount of terms in the partial sum
+   */
+	T S_n(const K n) const;
+
+	/**
+   * @brief Fills the spans with consecutive terms a_n, a_{n+1}, ... and partial sums S_n, S_{n+1}, ... accumulated in T
+   * If the series uses a narrower type, its terms are generated by its vectorized fill_terms in that type and then widened.
+   * If the terms are cached, the cached ones are copied and only the rest are generated
+   * @param n The number of the first term
+   * @param terms The span to be filled with the terms
+   * @param partial_sums The span of the same size to be filled with the partial sums
+   */
+	void fill_terms_and_partial_sums(const K n, std::span<T> terms, std::span<T> partial_sums) const;
+
+private:
+	/**
+   * @brief Whether the terms are cached: the term cache is on or the series uses a narrower type and its partial sum cache is on,
+   * in the latter case S_n costs the same as with the cache of the series
+   */
+	bool use_term_cache() const;
+
+	/**
+   * @brief Whether the term cache is on, see enable_term_cache
+   */
+	bool term_cache_enabled = false;
+
+	/**
+   * @brief The cached terms a_0, a_1, ... widened to T
+   */
+	mutable std::vector<T> cached_terms;
+
+	/**
+   * @brief The cached partial sums, cached_partial_sums[i] = S_n(i), it has the size of cached_terms
+   */
+	mutable std::vector<T> cached_partial_sums;
 };
 
 template <typename T, typename K, typename series_templ>
@@ -67,3 +279,220 @@ constexpr void series_acceleration<T, K, series_templ>::print_info() const
 {
 	std::cout << "transformation: " << typeid(*this).name() << std::endl;
 }
+
+template <typename T, typename K, typename series_templ>
+T series_acceleration<T, K, series_templ>::operator()(const K n, const int order) const
+{
+	if (n < 0 || order < 0)
+		throw std::domain_error("negative integer in the input");
+	SHANKS_TRACE_SPAN("transform");
+	const T result = evaluate(n, order);
+	if (!series_math::isfinite(result))
+		throw std::overflow_error("division by zero");
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+eval_result<T> series_acceleration<T, K, series_templ>::try_eval(const K n, const int order) const noexcept
+{
+	if (n < 0 || order < 0)
+		return { std::numeric_limits<T>::quiet_NaN(), eval_status::invalid_argument };
+	SHANKS_TRACE_SPAN("transform");
+	try
+	{
+		const T result = evaluate(n, order);
+		return { result, series_math::isfinite(result) ? eval_status::ok : eval_status::non_finite };
+	}
+	catch (...)
+	{
+		return { std::numeric_limits<T>::quiet_NaN(), current_exception_status() };
+	}
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<T> series_acceleration<T, K, series_templ>::sweep(const K N, const int order) const
+{
+	if (N < 0 || order < 0)
+		throw std::domain_error("negative integer in the input");
+	SHANKS_TRACE_SPAN("sweep");
+	std::vector<T> result(N);
+	SHANKS_COUNT(scratch_bytes, N * sizeof(T));
+	for (K n = 1; n <= N; ++n)
+		result[n - 1] = evaluate(n, order);
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<eval_result<T>> series_acceleration<T, K, series_templ>::try_sweep(const K N, const int order) const noexcept
+{
+	if (N < 0 || order < 0)
+		return {};
+	eval_status failure;
+	try
+	{
+		const auto values = sweep(N, order);
+		std::vector<eval_result<T>> result(values.size());
+		for (std::size_t i = 0; i < values.size(); ++i)
+			result[i] = { values[i], series_math::isfinite(values[i]) ? eval_status::ok : eval_status::non_finite };
+		return result;
+	}
+	catch (...)
+	{
+		failure = current_exception_status();
+	}
+	try
+	{
+		return std::vector<eval_result<T>>(static_cast<std::size_t>(N), { std::numeric_limits<T>::quiet_NaN(), failure });
+	}
+	catch (...) // no memory even for the statuses
+	{
+		return {};
+	}
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<std::vector<T>> series_acceleration<T, K, series_templ>::sweep_orders(const K N, const int max_order) const
+{
+	std::vector<std::vector<T>> result;
+	for (int order = 0; order <= max_order; ++order)
+		result.push_back(sweep(N, order));
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+K series_acceleration<T, K, series_templ>::terms_required(const K n, const int order) const
+{
+	return n + order + 1;
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t series_acceleration<T, K, series_templ>::sweep_terms_required(const K N, const int order) const
+{
+	std::size_t terms = 0;
+	for (K n = 1; n <= N; ++n)
+		terms += static_cast<std::size_t>(terms_required(n, order));
+	return terms;
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t series_acceleration<T, K, series_templ>::operations_required(const K, const int order) const
+{
+	return 4 * static_cast<std::size_t>(order) * order;
+}
+
+template <typename T, typename K, typename series_templ>
+void series_acceleration<T, K, series_templ>::enable_term_cache(const bool enable)
+{
+	term_cache_enabled = enable;
+	if (!use_term_cache())
+	{
+		cached_terms.clear();
+		cached_partial_sums.clear();
+	}
+}
+
+template <typename T, typename K, typename series_templ>
+bool series_acceleration<T, K, series_templ>::is_term_cache_enabled() const
+{
+	return term_cache_enabled;
+}
+
+template <typename T, typename K, typename series_templ>
+bool series_acceleration<T, K, series_templ>::use_term_cache() const
+{
+	if constexpr (std::is_same_v<term_type, T>)
+		return term_cache_enabled;
+	else
+		return term_cache_enabled || series->is_partial_sum_cache_enabled();
+}
+
+template <typename T, typename K, typename series_templ>
+T series_acceleration<T, K, series_templ>::term(const K n) const
+{
+	const bool cached = use_term_cache();
+	if (cached && static_cast<std::size_t>(n) < cached_terms.size())
+		return cached_terms[n];
+	SHANKS_COUNT(terms, 1);
+	const T a_n = static_cast<T>(series->term(n));
+	if (cached && static_cast<std::size_t>(n) == cached_terms.size())
+	{
+		cached_partial_sums.push_back(n ? cached_partial_sums.back() + a_n : a_n);
+		cached_terms.push_back(a_n);
+	}
+	return a_n;
+}
+
+template <typename T, typename K, typename series_templ>
+T series_acceleration<T, K, series_templ>::S_n(const K n) const
+{
+	SHANKS_TRACE_SPAN("partial sum");
+	if (use_term_cache())
+	{
+		SHANKS_COUNT(partial_sums, 1); // the new terms are counted by term
+		for (K i = static_cast<K>(cached_terms.size()); i <= n; ++i)
+			term(i); // appends a_i and S_i to the cache
+		return cached_partial_sums[n];
+	}
+	if constexpr (std::is_same_v<term_type, T>)
+		return series->S_n(n);
+	else
+	{
+		SHANKS_COUNT(partial_sums, 1); // the terms are counted by term
+		T sum = 0;
+		for (K i = 0; i <= n; ++i)
+			sum += term(i);
+		return sum;
+	}
+}
+
+template <typename T, typename K, typename series_templ>
+void series_acceleration<T, K, series_templ>::fill_terms_and_partial_sums(const K n, std::span<T> terms, std::span<T> partial_sums) const
+{
+	SHANKS_TRACE_SPAN("terms");
+	if (terms.size() != partial_sums.size())
+		throw std::domain_error("the spans for the terms and the partial sums differ in size");
+	const bool use_cache = use_term_cache();
+	std::size_t cached = 0; // the leading terms taken from the cache
+	if (use_cache && static_cast<std::size_t>(n) < cached_terms.size())
+	{
+		cached = std::min(terms.size(), cached_terms.size() - static_cast<std::size_t>(n));
+		std::copy_n(cached_terms.begin() + n, cached, terms.begin());
+		std::copy_n(cached_partial_sums.begin() + n, cached, partial_sums.begin());
+	}
+	const K first = n + static_cast<K>(cached);
+	const auto new_terms = terms.subspan(cached);
+	const auto new_partial_sums = partial_sums.subspan(cached);
+	if (new_terms.empty())
+		return;
+	SHANKS_COUNT(terms, new_terms.size());
+	SHANKS_COUNT(partial_sums, new_partial_sums.size());
+	if constexpr (std::is_same_v<term_type, T>)
+	{
+		if (!use_cache)
+		{
+			series->fill_terms_and_partial_sums(first, new_terms, new_partial_sums);
+			return;
+		}
+		series->fill_terms(first, new_terms);
+	}
+	else
+	{
+		thread_local std::vector<term_type> narrow_terms;
+		SHANKS_COUNT(scratch_bytes, new_terms.size() * sizeof(term_type)); // counted on every call, even if the buffer of the thread is reused
+		narrow_terms.resize(new_terms.size());
+		series->fill_terms(first, narrow_terms);
+		for (std::size_t i = 0; i < new_terms.size(); ++i)
+			new_terms[i] = static_cast<T>(narrow_terms[i]);
+	}
+	T sum = first ? S_n(first - 1) : 0; // from the cache if it is on
+	for (std::size_t i = 0; i < new_terms.size(); ++i)
+	{
+		sum += new_terms[i];
+		new_partial_sums[i] = sum;
+	}
+	if (use_cache && cached_terms.size() == static_cast<std::size_t>(first))
+	{
+		cached_terms.insert(cached_terms.end(), new_terms.begin(), new_terms.end());
+		cached_partial_sums.insert(cached_partial_sums.end(), new_partial_sums.begin(), new_partial_sums.end());
+	}
+}
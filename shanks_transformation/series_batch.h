@@ -0,0 +1,390 @@
+/**
+ * @file series_batch.h
+ * List of series batches currently avaiable:
+ * 1 - exp_series_batch
+ * 2 - bin_series_batch
+ * 3 - four_arctan_series_batch
+ * 4 - erf_series_batch
+ * @brief This file contains the batches of functional series, one series evaluated at many arguments x at once
+ * A batch keeps the arguments in a single array (the structure of arrays layout) and generates the terms of all of them together,
+ * the SIMD lanes run across the arguments. The transformations of the batches are in batch_acceleration.h
+ */
+
+#pragma once
+#include <vector>  // Include the vector library
+#include <span>    // Include the span library
+#include <cmath>   // Include the cmath library for the sums of the series
+#include <numbers> // Include the numbers library for std::numbers::pi_v
+#include <string>  // Include the string library for std::to_string
+#include <stdexcept> // Include the stdexcept library for std::domain_error
+#include <limits>  // Include the limits library for std::numeric_limits
+#include "simd_kernels.h"
+#include "series_math.h"
+
+/**
+* @brief Abstract class for the batches of series
+* The terms of the series in the batch satisfy a_{n+1}(x) = a_n(x) * step_ratio(n) * lane_ratio(x), so every next term of all the arguments
+* costs a single multiplication of the lanes by the broadcast step_ratio(n).
+* The arguments are padded with the copies of the last one up to a multiple of the SIMD width, the padding lanes are computed and never returned.
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class series_batch
+{
+public:
+	/**
+	* @brief Parameterized constructor to initialize the batch with the arguments
+	* @param x The arguments of the series
+	*/
+	series_batch(std::vector<T> x);
+
+	virtual ~series_batch() = default;
+
+	/**
+	* @brief The number of the arguments in the batch
+	*/
+	[[nodiscard]] std::size_t size() const;
+
+	/**
+	* @brief The number of the lanes, it is size() rounded up to a multiple of simd_pack<T>::width
+	* The lane j holds the argument j, the lanes past size() hold the padding
+	*/
+	[[nodiscard]] std::size_t lanes() const;
+
+	/**
+	* @brief x getter, the arguments without the padding
+	*/
+	[[nodiscard]] std::span<const T> get_x() const;
+
+	/**
+	* @brief Computes the sums of the series for all the arguments
+	* @return The vector of size() sums
+	*/
+	[[nodiscard]] std::vector<T> get_sum() const;
+
+	/**
+	* @brief Fills the rows of the terms a_0, ..., a_N and the partial sums S_0, ..., S_N of the lanes first, ..., first + tile - 1
+	* The row m holds the elements tile * m, ..., tile * (m + 1) - 1, its element j belongs to the lane first + j.
+	* The transformations fill the lanes by tiles of tile_lanes, so that their tables stay in the cache
+	* @param N The number of the last term
+	* @param first The first lane, it must be a multiple of simd_pack<T>::width
+	* @param tile The number of the lanes, it must be a multiple of simd_pack<T>::width
+	* @param terms The span of (N + 1) * tile elements to be filled with the terms
+	* @param partial_sums The span of (N + 1) * tile elements to be filled with the partial sums
+	*/
+	void fill_terms_and_partial_sums(K N, std::size_t first, std::size_t tile, std::span<T> terms, std::span<T> partial_sums) const;
+
+	/**
+	* @brief The number of the lanes the transformations process at once, a multiple of simd_pack<T>::width
+	*/
+	static constexpr std::size_t tile_lanes = 64;
+
+protected:
+	/**
+	* @brief Computes the first term a_0 of the series at the argument x
+	*/
+	[[nodiscard]] virtual T first_term(T x) const = 0;
+
+	/**
+	* @brief Computes the factor of a_{n+1}(x) / a_n(x) that depends on x only
+	*/
+	[[nodiscard]] virtual T lane_ratio(T x) const = 0;
+
+	/**
+	* @brief Computes the factor of a_{n+1}(x) / a_n(x) that depends on n only
+	* @param n The number of the known term
+	*/
+	[[nodiscard]] virtual T step_ratio(K n) const = 0;
+
+	/**
+	* @brief Computes the sum of the series at the argument x
+	*/
+	[[nodiscard]] virtual T sum(T x) const = 0;
+
+	/**
+	* @brief The arguments of the series padded up to lanes() elements
+	*/
+	std::vector<T> x;
+
+	/**
+	* @brief The number of the arguments without the padding
+	*/
+	std::size_t count;
+};
+
+template <typename T, typename K>
+series_batch<T, K>::series_batch(std::vector<T> x) : x(std::move(x)), count(this->x.size())
+{
+	static_assert(std::numeric_limits<T>::is_specialized && !std::numeric_limits<T>::is_integer); // float, double, long double or double_double
+	static_assert(std::numeric_limits<K>::is_integer);
+	constexpr std::size_t width = simd_pack<T>::width;
+	if (count)
+		this->x.resize((count + width - 1) / width * width, this->x.back());
+}
+
+template <typename T, typename K>
+std::size_t series_batch<T, K>::size() const
+{
+	return count;
+}
+
+template <typename T, typename K>
+std::size_t series_batch<T, K>::lanes() const
+{
+	return x.size();
+}
+
+template <typename T, typename K>
+std::span<const T> series_batch<T, K>::get_x() const
+{
+	return std::span<const T>(x).first(count);
+}
+
+template <typename T, typename K>
+std::vector<T> series_batch<T, K>::get_sum() const
+{
+	std::vector<T> sums(count);
+	for (std::size_t j = 0; j < count; ++j)
+		sums[j] = sum(x[j]);
+	return sums;
+}
+
+template <typename T, typename K>
+void series_batch<T, K>::fill_terms_and_partial_sums(K N, std::size_t first, std::size_t tile, std::span<T> terms, std::span<T> partial_sums) const
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	if (N < 0)
+		throw std::domain_error("negative integer in the input");
+	if (first % width || tile % width || first + tile > lanes())
+		throw std::domain_error("the lanes are out of the batch");
+	if (terms.size() != (N + 1) * tile || partial_sums.size() != terms.size())
+		throw std::domain_error("the spans for the terms and the partial sums differ in size from the table of the lanes");
+
+	std::vector<T> ratios(tile);
+	for (std::size_t j = 0; j < tile; ++j)
+	{
+		terms[j] = partial_sums[j] = first_term(x[first + j]);
+		ratios[j] = lane_ratio(x[first + j]);
+	}
+	for (K m = 1; m <= N; ++m)
+	{
+		const auto step = pack::broadcast(step_ratio(m - 1));
+		const std::size_t row = m * tile;
+		for (std::size_t j = 0; j < tile; j += width)
+		{
+			const auto a_m = pack::load(&terms[row - tile + j]) * (step * pack::load(&ratios[j]));
+			a_m.store(&terms[row + j]);
+			(pack::load(&partial_sums[row - tile + j]) + a_m).store(&partial_sums[row + j]);
+		}
+	}
+}
+
+/**
+* @brief Batch of the Maclaurin series of exponent, a_n = x^n / n!
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class exp_series_batch final : public series_batch<T, K>
+{
+public:
+	/**
+	* @brief Parameterized constructor to initialize the batch with the arguments
+	* @param x The arguments of the series
+	*/
+	exp_series_batch(std::vector<T> x);
+
+protected:
+	[[nodiscard]] T first_term(T x) const override;
+	[[nodiscard]] T lane_ratio(T x) const override;
+	[[nodiscard]] T step_ratio(K n) const override;
+	[[nodiscard]] T sum(T x) const override;
+};
+
+template <typename T, typename K>
+exp_series_batch<T, K>::exp_series_batch(std::vector<T> x) : series_batch<T, K>(std::move(x)) {}
+
+template <typename T, typename K>
+T exp_series_batch<T, K>::first_term(T) const
+{
+	return 1;
+}
+
+template <typename T, typename K>
+T exp_series_batch<T, K>::lane_ratio(T x) const
+{
+	return x;
+}
+
+template <typename T, typename K>
+T exp_series_batch<T, K>::step_ratio(K n) const
+{
+	return static_cast<T>(1) / (n + 1);
+}
+
+template <typename T, typename K>
+T exp_series_batch<T, K>::sum(T x) const
+{
+	return series_math::exp(x);
+}
+
+/**
+* @brief Batch of the Maclaurin series of (1 + x)^alpha with the common alpha, a_n = C(alpha, n) * x^n
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class bin_series_batch final : public series_batch<T, K>
+{
+public:
+	/**
+	* @brief Parameterized constructor to initialize the batch with the arguments and the power
+	* @param x The arguments of the series, |x| must not exceed 1
+	* @param alpha The power of the series
+	*/
+	bin_series_batch(std::vector<T> x, T alpha);
+
+protected:
+	[[nodiscard]] T first_term(T x) const override;
+	[[nodiscard]] T lane_ratio(T x) const override;
+	[[nodiscard]] T step_ratio(K n) const override;
+	[[nodiscard]] T sum(T x) const override;
+
+private:
+	const T alpha;
+};
+
+template <typename T, typename K>
+bin_series_batch<T, K>::bin_series_batch(std::vector<T> x, T alpha) : series_batch<T, K>(std::move(x)), alpha(alpha)
+{
+	for (const T x_j : this->get_x())
+		if (series_math::abs(x_j) > 1)
+			throw std::domain_error("series diverge");
+}
+
+template <typename T, typename K>
+T bin_series_batch<T, K>::first_term(T) const
+{
+	return 1;
+}
+
+template <typename T, typename K>
+T bin_series_batch<T, K>::lane_ratio(T x) const
+{
+	return x;
+}
+
+template <typename T, typename K>
+T bin_series_batch<T, K>::step_ratio(K n) const
+{
+	const T k = n;
+	return (alpha - k) / (k + 1);
+}
+
+template <typename T, typename K>
+T bin_series_batch<T, K>::sum(T x) const
+{
+	return series_math::pow(1 + x, alpha);
+}
+
+/**
+* @brief Batch of the Maclaurin series of arctan multiplied by four, a_n = 4 * (-1)^n * x^{2n+1} / (2n + 1)
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class four_arctan_series_batch final : public series_batch<T, K>
+{
+public:
+	/**
+	* @brief Parameterized constructor to initialize the batch with the arguments
+	* @param x The arguments of the series, |x| must not exceed 1
+	*/
+	four_arctan_series_batch(std::vector<T> x);
+
+protected:
+	[[nodiscard]] T first_term(T x) const override;
+	[[nodiscard]] T lane_ratio(T x) const override;
+	[[nodiscard]] T step_ratio(K n) const override;
+	[[nodiscard]] T sum(T x) const override;
+};
+
+template <typename T, typename K>
+four_arctan_series_batch<T, K>::four_arctan_series_batch(std::vector<T> x) : series_batch<T, K>(std::move(x))
+{
+	for (const T x_j : this->get_x())
+		if (series_math::abs(x_j) > 1)
+			throw std::domain_error("the arctan series diverge at x = " + series_math::to_string(x_j));
+}
+
+template <typename T, typename K>
+T four_arctan_series_batch<T, K>::first_term(T x) const
+{
+	return 4 * x;
+}
+
+template <typename T, typename K>
+T four_arctan_series_batch<T, K>::lane_ratio(T x) const
+{
+	return -x * x;
+}
+
+template <typename T, typename K>
+T four_arctan_series_batch<T, K>::step_ratio(K n) const
+{
+	const T k = n;
+	return (2 * k + 1) / (2 * k + 3);
+}
+
+template <typename T, typename K>
+T four_arctan_series_batch<T, K>::sum(T x) const
+{
+	return 4 * series_math::atan(x);
+}
+
+/**
+* @brief Batch of the Maclaurin series of sqrt(pi) * erf(x) / 2, a_n = (-1)^n * x^{2n+1} / (n! * (2n + 1))
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+*/
+template <typename T, typename K>
+class erf_series_batch final : public series_batch<T, K>
+{
+public:
+	/**
+	* @brief Parameterized constructor to initialize the batch with the arguments
+	* @param x The arguments of the series
+	*/
+	erf_series_batch(std::vector<T> x);
+
+protected:
+	[[nodiscard]] T first_term(T x) const override;
+	[[nodiscard]] T lane_ratio(T x) const override;
+	[[nodiscard]] T step_ratio(K n) const override;
+	[[nodiscard]] T sum(T x) const override;
+};
+
+template <typename T, typename K>
+erf_series_batch<T, K>::erf_series_batch(std::vector<T> x) : series_batch<T, K>(std::move(x)) {}
+
+template <typename T, typename K>
+T erf_series_batch<T, K>::first_term(T x) const
+{
+	return x;
+}
+
+template <typename T, typename K>
+T erf_series_batch<T, K>::lane_ratio(T x) const
+{
+	return -x * x;
+}
+
+template <typename T, typename K>
+T erf_series_batch<T, K>::step_ratio(K n) const
+{
+	const T k = n;
+	return (2 * k + 1) / ((k + 1) * (2 * k + 3));
+}
+
+template <typename T, typename K>
+T erf_series_batch<T, K>::sum(T x) const
+{
+	return series_math::sqrt(std::numbers::pi_v<T>) * series_math::erf(x) * 0.5;
+}
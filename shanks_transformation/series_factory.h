@@ -0,0 +1,246 @@
+/**
+ * @file series_factory.h
+ * @brief This file contains the ids of the series and the transformations and the functions that create them by id
+ */
+
+#pragma once
+#include <memory> // Include the memory library for std::unique_ptr
+#include <array> // Include the array library for the ids of the alternating series
+#include <algorithm> // Include the algorithm library for std::ranges::find
+#include "shanks_transformation.h"
+#include "epsilon_algorithm.h"
+#include "levin_algorithm.h"
+#include "richardson_algorithm.h"
+#include "cvz_algorithm.h"
+#include "rho_algorithm.h"
+#include "theta_algorithm.h"
+#include "euler_maclaurin.h"
+#include "series_batch.h"
+
+enum transformation_id_t {
+	null_transformation_id, 
+	shanks_transformation_id, 
+	epsilon_algorithm_id,
+	levin_u_algorithm_id,
+	levin_t_algorithm_id,
+	levin_v_algorithm_id,
+	richardson_algorithm_id,
+	cvz_algorithm_id,
+	rho_algorithm_id,
+	theta_algorithm_id,
+	euler_maclaurin_algorithm_id
+};
+enum series_id_t {
+	null_series_id, 
+	exp_series_id, 
+	cos_series_id, 
+	sin_series_id, 
+	cosh_series_id,
+	sinh_series_id, 
+	bin_series_id, 
+	four_arctan_series_id, 
+	ln1mx_series_id, 
+	mean_sinh_sin_series_id,
+	exp_squared_erf_series_id, 
+	xmb_Jb_two_series_id, 
+	half_asin_two_x_series_id,
+	inverse_1mx_series_id,
+	x_1mx_squared_series_id,
+	erf_series_id,
+	m_fact_1mx_mp1_inverse_series_id,
+	inverse_sqrt_1m4x_series_id,
+	one_twelfth_3x2_pi2_series_id,
+	x_twelfth_x2_pi2_series_id,
+	ln2_series_id,
+	one_series_id,
+	minus_one_quarter_series_id,
+	pi_3_series_id,
+	pi_4_series_id,
+	pi_squared_6_minus_one_series_id,
+	three_minus_pi_series_id,
+	one_twelfth_series_id,
+	eighth_pi_m_one_third_series_id,
+	one_third_pi_squared_m_nine_series_id,
+	four_ln2_m_3_series_id,
+	exp_m_cos_x_sinsin_x_series_id
+};
+
+/**
+* @brief Creates the series with the given id
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @param series_id The id of the series, see series_id_t
+* @param x The argument of the functional series, the numerical series ignore it
+* @param alpha The constant alpha of bin_series
+* @param b The constant b of xmb_Jb_two_series
+* @param m The constant m of m_fact_1mx_mp1_inverse_series
+* @return The series
+*/
+template <typename T, typename K>
+inline static std::unique_ptr<series_base<T, K>> make_series(const int series_id, const T x, const T alpha = 0, const K b = 0, const K m = 0)
+{
+	switch (series_id)
+	{
+	case series_id_t::exp_series_id:
+		return std::make_unique<exp_series<T, K>>(x);
+	case series_id_t::cos_series_id:
+		return std::make_unique<cos_series<T, K>>(x);
+	case series_id_t::sin_series_id:
+		return std::make_unique<sin_series<T, K>>(x);
+	case series_id_t::cosh_series_id:
+		return std::make_unique<cosh_series<T, K>>(x);
+	case series_id_t::sinh_series_id:
+		return std::make_unique<sinh_series<T, K>>(x);
+	case series_id_t::bin_series_id:
+		return std::make_unique<bin_series<T, K>>(x, alpha);
+	case series_id_t::four_arctan_series_id:
+		return std::make_unique<four_arctan_series<T, K>>(x);
+	case series_id_t::ln1mx_series_id:
+		return std::make_unique<ln1mx_series<T, K>>(x);
+	case series_id_t::mean_sinh_sin_series_id:
+		return std::make_unique<mean_sinh_sin_series<T, K>>(x);
+	case series_id_t::exp_squared_erf_series_id:
+		return std::make_unique<exp_squared_erf_series<T, K>>(x);
+	case series_id_t::xmb_Jb_two_series_id:
+		return std::make_unique<xmb_Jb_two_series<T, K>>(x, b);
+	case series_id_t::half_asin_two_x_series_id:
+		return std::make_unique<half_asin_two_x_series<T, K>>(x);
+	case series_id_t::inverse_1mx_series_id:
+		return std::make_unique<inverse_1mx_series<T, K>>(x);
+	case series_id_t::x_1mx_squared_series_id:
+		return std::make_unique<x_1mx_squared_series<T, K>>(x);
+	case series_id_t::erf_series_id:
+		return std::make_unique<erf_series<T, K>>(x);
+	case series_id_t::m_fact_1mx_mp1_inverse_series_id:
+		return std::make_unique<m_fact_1mx_mp1_inverse_series<T, K>>(x, m);
+	case series_id_t::inverse_sqrt_1m4x_series_id:
+		return std::make_unique<inverse_sqrt_1m4x_series<T, K>>(x);
+	case series_id_t::one_twelfth_3x2_pi2_series_id:
+		return std::make_unique<one_twelfth_3x2_pi2_series<T, K>>(x);
+	case series_id_t::x_twelfth_x2_pi2_series_id:
+		return std::make_unique<x_twelfth_x2_pi2_series<T, K>>(x);
+	case series_id_t::ln2_series_id:
+		return std::make_unique<ln2_series<T, K>>();
+	case series_id_t::one_series_id:
+		return std::make_unique<one_series<T, K>>();
+	case series_id_t::minus_one_quarter_series_id:
+		return std::make_unique<minus_one_quarter_series<T, K>>();
+	case series_id_t::pi_3_series_id:
+		return std::make_unique<pi_3_series<T, K>>();
+	case series_id_t::pi_4_series_id:
+		return std::make_unique<pi_4_series<T, K>>();
+	case series_id_t::pi_squared_6_minus_one_series_id:
+		return std::make_unique<pi_squared_6_minus_one_series<T, K>>();
+	case series_id_t::three_minus_pi_series_id:
+		return std::make_unique<three_minus_pi_series<T, K>>();
+	case series_id_t::one_twelfth_series_id:
+		return std::make_unique<one_twelfth_series<T, K>>();
+	case series_id_t::eighth_pi_m_one_third_series_id:
+		return std::make_unique<eighth_pi_m_one_third_series<T, K>>();
+	case series_id_t::one_third_pi_squared_m_nine_series_id:
+		return std::make_unique<one_third_pi_squared_m_nine_series<T, K>>();
+	case series_id_t::four_ln2_m_3_series_id:
+		return std::make_unique<four_ln2_m_3_series<T, K>>();
+	case series_id_t::exp_m_cos_x_sinsin_x_series_id:
+		return std::make_unique<exp_m_cos_x_sinsin_x_series<T, K>>(x);
+	default:
+		throw std::domain_error("wrong series_id");
+	}
+}
+
+/**
+* @brief Creates the batch of the series with the given id at many arguments, see series_batch.h
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @param series_id The id of the series, only exp_series, bin_series, four_arctan_series and erf_series have batches
+* @param x The arguments of the series
+* @param alpha The constant alpha of bin_series
+* @return The batch
+*/
+template <typename T, typename K>
+inline static std::unique_ptr<series_batch<T, K>> make_series_batch(const int series_id, std::vector<T> x, const T alpha = 0)
+{
+	switch (series_id)
+	{
+	case series_id_t::exp_series_id:
+		return std::make_unique<exp_series_batch<T, K>>(std::move(x));
+	case series_id_t::bin_series_id:
+		return std::make_unique<bin_series_batch<T, K>>(std::move(x), alpha);
+	case series_id_t::four_arctan_series_id:
+		return std::make_unique<four_arctan_series_batch<T, K>>(std::move(x));
+	case series_id_t::erf_series_id:
+		return std::make_unique<erf_series_batch<T, K>>(std::move(x));
+	default:
+		throw std::domain_error("the series has no batch version");
+	}
+}
+
+/**
+ * @brief The ids of the alternating series, the Shanks transformation has a separate version for them
+ */
+inline constexpr std::array alternating_series_ids = {
+	cos_series_id,
+	sin_series_id,
+	four_arctan_series_id,
+	xmb_Jb_two_series_id,
+	erf_series_id,
+	one_twelfth_3x2_pi2_series_id,
+	x_twelfth_x2_pi2_series_id,
+	ln2_series_id,
+	minus_one_quarter_series_id,
+	pi_4_series_id,
+	three_minus_pi_series_id,
+	eighth_pi_m_one_third_series_id,
+	four_ln2_m_3_series_id,
+	exp_m_cos_x_sinsin_x_series_id
+};
+
+/**
+* @brief Whether the series with the given id is alternating
+* @param series_id The id of the series, see series_id_t
+* @return true if the signs of the terms alternate
+*/
+constexpr bool is_alternating_series(const int series_id)
+{
+	return std::ranges::find(alternating_series_ids, series_id) != alternating_series_ids.end();
+}
+
+/**
+* @brief Creates the transformation with the given id
+* @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+* @param transformation_id The id of the transformation, see transformation_id_t
+* @param series The series to be accelerated
+* @param alternating Whether the series is alternating, the Shanks transformation has a separate version for such series
+* @return The transformation
+*/
+template <typename T, typename K, typename series_templ>
+inline static std::unique_ptr<series_acceleration<T, K, series_templ>> make_transformation(const int transformation_id, const series_templ& series, const bool alternating)
+{
+	switch (transformation_id)
+	{
+	case transformation_id_t::shanks_transformation_id:
+		if (alternating)
+			return std::make_unique<shanks_transform_alternating<T, K, series_templ>>(series);
+		return std::make_unique<shanks_transform<T, K, series_templ>>(series);
+	case transformation_id_t::epsilon_algorithm_id:
+		return std::make_unique<epsilon_algorithm<T, K, series_templ>>(series);
+	case transformation_id_t::levin_u_algorithm_id:
+		return std::make_unique<levin_algorithm<T, K, series_templ>>(series, levin_u_variant);
+	case transformation_id_t::levin_t_algorithm_id:
+		return std::make_unique<levin_algorithm<T, K, series_templ>>(series, levin_t_variant);
+	case transformation_id_t::levin_v_algorithm_id:
+		return std::make_unique<levin_algorithm<T, K, series_templ>>(series, levin_v_variant);
+	case transformation_id_t::richardson_algorithm_id:
+		return std::make_unique<richardson_algorithm<T, K, series_templ>>(series);
+	case transformation_id_t::cvz_algorithm_id:
+		if (!alternating)
+			throw std::domain_error("the Cohen-Villegas-Zagier algorithm requires an alternating series");
+		return std::make_unique<cvz_algorithm<T, K, series_templ>>(series);
+	case transformation_id_t::rho_algorithm_id:
+		return std::make_unique<rho_algorithm<T, K, series_templ>>(series);
+	case transformation_id_t::theta_algorithm_id:
+		return std::make_unique<theta_algorithm<T, K, series_templ>>(series);
+	case transformation_id_t::euler_maclaurin_algorithm_id:
+		return std::make_unique<euler_maclaurin_algorithm<T, K, series_templ>>(series, alternating);
+	default:
+		throw std::domain_error("wrong transformation_id");
+	}
+}
@@ -0,0 +1,47 @@
+/**
+ * @file series_math.h
+ * @brief This file contains the mathematical functions called by the generic code of the series and the transformations.
+ * series_math::pow(this->x, n) calls std::pow for the built-in types of T and, by the argument-dependent lookup,
+ * the overload declared next to a number type of the user, e.g. pow of double_double.
+ * Unlike the using-declarations of the std functions at the namespace scope, they do not change the lookup in the files that include them.
+ */
+
+#pragma once
+#include <cmath>  // Include the cmath library for the std versions of the functions
+#include <string> // Include the string library for std::to_string
+
+namespace series_math
+{
+/*
+* The using-declaration in the body hides series_math::name, so the call finds the std version and the ones of the argument-dependent lookup
+*/
+#define SERIES_MATH_FUNCTION(name) \
+	template <typename... Args> \
+	constexpr auto name(const Args&... args) \
+	{ \
+		using std::name; \
+		return name(args...); \
+	}
+
+	SERIES_MATH_FUNCTION(abs)
+	SERIES_MATH_FUNCTION(isfinite)
+	SERIES_MATH_FUNCTION(fma)
+	SERIES_MATH_FUNCTION(ldexp)
+	SERIES_MATH_FUNCTION(sqrt)
+	SERIES_MATH_FUNCTION(pow)
+	SERIES_MATH_FUNCTION(exp)
+	SERIES_MATH_FUNCTION(log)
+	SERIES_MATH_FUNCTION(log10)
+	SERIES_MATH_FUNCTION(sin)
+	SERIES_MATH_FUNCTION(cos)
+	SERIES_MATH_FUNCTION(sinh)
+	SERIES_MATH_FUNCTION(cosh)
+	SERIES_MATH_FUNCTION(atan)
+	SERIES_MATH_FUNCTION(asin)
+	SERIES_MATH_FUNCTION(erf)
+	SERIES_MATH_FUNCTION(tgamma)
+	SERIES_MATH_FUNCTION(cyl_bessel_j)
+	SERIES_MATH_FUNCTION(to_string)
+
+#undef SERIES_MATH_FUNCTION
+}
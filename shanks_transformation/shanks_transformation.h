@@ -4,10 +4,10 @@
  */
 
 #pragma once
-#define DEF_UNDEFINED_SUM 0
 
 #include "series_acceleration.h" // Include the series header
 #include <vector>  // Include the vector library
+#include <span>    // Include the span library
 
 /**
 * @brief Shanks transformation for non-alternating series class.
@@ -27,76 +27,203 @@ public:
 
 	/**
    * @brief Shanks transformation for non-alternating function.
+   * It runs in a thread-local workspace of workspace_size(order) elements, so the repeated calls do not allocate memory.
    * @authors Bolshakov M.P., Pashkov B.B.
    * @param n The number of terms in the partial sum.
    * @param order The order of transformation.
    * @return The partial sum after the transformation.
    */
-	T operator()(const K n, const int order) const;
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief Shanks transformation for non-alternating function in a caller-supplied workspace.
+   * Like evaluate(n, order) it does not check n and order and returns a non-finite value on the division by zero.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation.
+   * @param workspace The scratch memory of at least workspace_size(order) elements.
+   * @return The partial sum after the transformation.
+   */
+	T evaluate(const K n, const int order, std::span<T> workspace) const;
+
+	/**
+   * @brief The size of the workspace needed for the transformation of the given order.
+   * Only the window of the first order transformations T_{n-order+1}, ..., T_{n+order-1} is ever used.
+   * @param order The order of transformation.
+   */
+	static constexpr std::size_t workspace_size(const int order);
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N of the given order in one pass.
+   * @param N The number of terms of the last transformed partial sum.
+   * @param order The order of transformation.
+   * @return The vector of T_1, ..., T_N.
+   */
+	std::vector<T> sweep(const K N, const int order) const;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N for every order up to max_order in one pass.
+   * The first order is computed once for all the partial sums and every next order is computed in place from the previous one,
+   * so the cost is O(N * max_order).
+   * @param N The number of terms of the last transformed partial sum.
+   * @param max_order The highest order of transformation.
+   * @return The vector whose element [order][n - 1] is T_n of the order.
+   */
+	std::vector<std::vector<T>> sweep_orders(const K N, const int max_order) const;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order), the terms are evaluated once for all n
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	std::size_t sweep_terms_required(const K N, const int order) const override;
 };
 
 template <typename T, typename K, typename series_templ>
 shanks_transform<T, K, series_templ>::shanks_transform(const series_templ& series) : series_acceleration<T, K, series_templ>(series) {}
 
 template <typename T, typename K, typename series_templ>
-T shanks_transform<T, K, series_templ>::operator()(const K n, const int order) const
+T shanks_transform<T, K, series_templ>::evaluate(const K n, const int order) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	else if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
-		return this->series->S_n(n);
+	thread_local std::vector<T> workspace;
+	SHANKS_COUNT(scratch_bytes, workspace_size(order) * sizeof(T)); // counted on every call, even if the buffer of the thread is reused
+	if (workspace.size() < workspace_size(order))
+		workspace.resize(workspace_size(order));
+	return evaluate(n, order, workspace);
+}
+
+template <typename T, typename K, typename series_templ>
+constexpr std::size_t shanks_transform<T, K, series_templ>::workspace_size(const int order)
+{
+	return order > 1 ? 2 * order - 1 : 0;
+}
+
+template <typename T, typename K, typename series_templ>
+T shanks_transform<T, K, series_templ>::evaluate(const K n, const int order, std::span<T> workspace) const
+{
+	if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
+		return this->S_n(n);
 	else if (n < order || n == 0)
 		return DEF_UNDEFINED_SUM;
 	else if (order == 1)
 	{
-		
-		const auto a_n = this->series->operator()(n);
-		const auto a_n_plus_1 = this->series->operator()(n + 1);
+		const auto a_n = this->term(n);
+		const auto a_n_plus_1 = this->term(n + 1);
 		const auto tmp = -a_n_plus_1 * a_n_plus_1;
 
-		const auto result = std::fma(a_n * a_n_plus_1, (a_n + a_n_plus_1) / (std::fma(a_n, a_n, tmp) - std::fma(a_n_plus_1, a_n_plus_1, tmp)), this->series->S_n(n));
-		if (!std::isfinite(result))
-			throw std::overflow_error("divison by zero");
+		const auto result = series_math::fma(a_n * a_n_plus_1, (a_n + a_n_plus_1) / (series_math::fma(a_n, a_n, tmp) - series_math::fma(a_n_plus_1, a_n_plus_1, tmp)), this->S_n(n));
+		SHANKS_COUNT(divisions, 1);
+		SHANKS_COUNT(table_cells, 1);
 		return result;
 	}
-	else [[likely]]//n > order >= 1
+	else [[likely]] //n > order >= 1
 	{
-		std::vector<T> T_n(n + order, 0);
-		auto a_n = this->series->operator()(n - order);
-		auto a_n_plus_1 = this->series->operator()(n - order + 1);
-		auto tmp = -a_n_plus_1 * a_n_plus_1;
-		for (int i = n - order + 1; i <= n + order - 1; ++i) // if we got to this branch then we know that n >= order - see previous branches
+		if (workspace.size() < workspace_size(order))
+			throw std::domain_error("the workspace is too small");
+		// workspace[k] holds the transformation at i = n - order + 1 + k, the window shrinks by one from both sides on every order
+		const K first = n - order + 1;
+		SHANKS_COUNT(divisions, 2 * order - 1);
+		SHANKS_COUNT(table_cells, 2 * order - 1);
+		auto partial_sum = this->S_n(first);
+		auto a_n_plus_1 = this->term(first);
+		for (int k = 0; k < 2 * order - 1; ++k) // if we got to this branch then we know that n >= order - see previous branches
 		{
-			a_n = this->series->operator()(i);
-			a_n_plus_1 = this->series->operator()(i + 1);
-			tmp = -a_n_plus_1 * a_n_plus_1;
+			const auto a_n = a_n_plus_1;
+			a_n_plus_1 = this->term(first + k + 1);
 
 			// formula [6]
-			T_n[i] = std::fma(a_n * a_n_plus_1, (a_n + a_n_plus_1) / (std::fma(a_n, a_n, tmp) - std::fma(a_n_plus_1, a_n_plus_1, tmp)), this->series->S_n(i));
+			const auto tmp = -a_n_plus_1 * a_n_plus_1;
+			workspace[k] = series_math::fma(a_n * a_n_plus_1, (a_n + a_n_plus_1) / (series_math::fma(a_n, a_n, tmp) - series_math::fma(a_n_plus_1, a_n_plus_1, tmp)), partial_sum);
+			partial_sum += a_n_plus_1;
 		}
-		std::vector<T> T_n_plus_1(n + order, 0);
+		SHANKS_TRACE_SPAN("shanks levels");
 		T a, b, c;
 		for (int j = 2; j <= order; ++j)
 		{
-			for (int i = n - order + j; i <= n + order - j; ++i)
+			SHANKS_COUNT(divisions, 2 * (order - j) + 1);
+			SHANKS_COUNT(table_cells, 2 * (order - j) + 1);
+			b = workspace[j - 2];
+			for (int k = j - 1; k <= 2 * order - 1 - j; ++k)
 			{
-				a = T_n[i];
-				b = T_n[i - 1];
-				c = T_n[i + 1];
-				/*if (!std::isfinite(abs(2 * T_n[i] - T_n[i - 1] - T_n[i + 1])))
-					throw std::overflow_error("division by zero");*/
-					/*T_n_plus_1[i] = T_n[i] - (T_n[i] - T_n[i - 1]) * (T_n[i + 1] - T_n[i]) / (T_n[i + 1] - 2 * T_n[i] + T_n[i - 1]);
-					T_n_plus_1[i] = std::fma(std::fma(T_n[i], T_n[i+1] + T_n[i-1] - T_n[i], -T_n[i-1]*T_n[i+1]), 1 / (2 * T_n[i] - T_n[i - 1] - T_n[i+1]), T_n[i]);*/
-				T_n_plus_1[i] = std::fma(std::fma(a, c + b - a, -b * c), 1 / (std::fma(2,a,-b-c)), a); 
+				a = workspace[k];
+				c = workspace[k + 1];
+				workspace[k] = series_math::fma(series_math::fma(a, c + b - a, -b * c), 1 / (series_math::fma(2, a, -b - c)), a);
+				b = a;
 			}
-			T_n = T_n_plus_1;
 		}
-		if (!std::isfinite(T_n[n]))
-			throw std::overflow_error("division by zero");
-		return T_n[n];
+		return workspace[order - 1];
 	}
 }
 
+template <typename T, typename K, typename series_templ>
+std::vector<T> shanks_transform<T, K, series_templ>::sweep(const K N, const int order) const
+{
+	return std::move(sweep_orders(N, order)[order]);
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<std::vector<T>> shanks_transform<T, K, series_templ>::sweep_orders(const K N, const int max_order) const
+{
+	if (N < 0 || max_order < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<std::vector<T>> result(max_order + 1, std::vector<T>(N, DEF_UNDEFINED_SUM));
+	if (N == 0)
+		return result;
+
+	const K last = N + max_order; // T_N of the highest order needs the terms up to a_{N+max_order}
+	std::vector<T> terms(last + 1);
+	std::vector<T> partial_sums(last + 1);
+	SHANKS_COUNT(scratch_bytes, ((max_order + 1) * N + 2 * (last + 1)) * sizeof(T)); // with the result
+	this->fill_terms_and_partial_sums(0, terms, partial_sums);
+
+	for (K n = 1; n <= N; ++n)
+		result[0][n - 1] = partial_sums[n];
+	if (max_order == 0)
+		return result;
+
+	std::vector<T> level(last, 0); // level[i] is the transformation of order j at i, it is valid for i from j to last - j
+	SHANKS_COUNT(scratch_bytes, last * sizeof(T));
+	SHANKS_COUNT(divisions, last - 1);
+	SHANKS_COUNT(table_cells, last - 1);
+	for (K i = 1; i < last; ++i)
+	{
+		const auto a_n = terms[i];
+		const auto a_n_plus_1 = terms[i + 1];
+		const auto tmp = -a_n_plus_1 * a_n_plus_1;
+
+		// formula [6]
+		level[i] = series_math::fma(a_n * a_n_plus_1, (a_n + a_n_plus_1) / (series_math::fma(a_n, a_n, tmp) - series_math::fma(a_n_plus_1, a_n_plus_1, tmp)), partial_sums[i]);
+	}
+
+	T a, b, c;
+	for (int order = 1; order <= max_order; ++order)
+	{
+		SHANKS_TRACE_SPAN("shanks level");
+		if (order > 1)
+		{
+			SHANKS_COUNT(divisions, last - 2 * order + 1);
+			SHANKS_COUNT(table_cells, last - 2 * order + 1);
+			b = level[order - 1];
+			for (K i = order; i <= last - order; ++i)
+			{
+				a = level[i];
+				c = level[i + 1];
+				level[i] = series_math::fma(series_math::fma(a, c + b - a, -b * c), 1 / (series_math::fma(2, a, -b - c)), a);
+				b = a;
+			}
+		}
+		for (K n = order; n <= N; ++n)
+			result[order][n - 1] = level[n];
+	}
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t shanks_transform<T, K, series_templ>::sweep_terms_required(const K N, const int order) const
+{
+	return static_cast<std::size_t>(this->terms_required(N, order));
+}
+
 /**
 * @brief Shanks transformation for alternating series class.
 * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
@@ -115,67 +242,195 @@ public:
 
 	/**
    * @brief Shanks transformation for alternating series function.
+   * It runs in a thread-local workspace of workspace_size(order) elements, so the repeated calls do not allocate memory.
    * @authors Bolshakov M.P., Pashkov B.B.
    * @param n The number of terms in the partial sum.
    * @param order The order of transformation.
    * @return The partial sum after the transformation.
    */
-	T operator()(const K n, const int order) const;
+	T evaluate(const K n, const int order) const override;
+
+	/**
+   * @brief Shanks transformation for alternating series function in a caller-supplied workspace.
+   * Like evaluate(n, order) it does not check n and order and returns a non-finite value on the division by zero.
+   * @param n The number of terms in the partial sum.
+   * @param order The order of transformation.
+   * @param workspace The scratch memory of at least workspace_size(order) elements.
+   * @return The partial sum after the transformation.
+   */
+	T evaluate(const K n, const int order, std::span<T> workspace) const;
+
+	/**
+   * @brief The size of the workspace needed for the transformation of the given order.
+   * Only the window of the first order transformations T_{n-order+1}, ..., T_{n+order-1} is ever used.
+   * @param order The order of transformation.
+   */
+	static constexpr std::size_t workspace_size(const int order);
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N of the given order in one pass.
+   * @param N The number of terms of the last transformed partial sum.
+   * @param order The order of transformation.
+   * @return The vector of T_1, ..., T_N.
+   */
+	std::vector<T> sweep(const K N, const int order) const;
+
+	/**
+   * @brief Computes the transformed partial sums T_1, ..., T_N for every order up to max_order in one pass.
+   * The first order is computed once for all the partial sums and every next order is computed in place from the previous one,
+   * so the cost is O(N * max_order).
+   * @param N The number of terms of the last transformed partial sum.
+   * @param max_order The highest order of transformation.
+   * @return The vector whose element [order][n - 1] is T_n of the order.
+   */
+	std::vector<std::vector<T>> sweep_orders(const K N, const int max_order) const;
+
+	/**
+   * @brief The number of the terms evaluated by sweep(N, order), the terms are evaluated once for all n
+   * @param N The number of terms of the last transformed partial sum
+   * @param order The order of the transformation
+   * @return The number of terms
+   */
+	std::size_t sweep_terms_required(const K N, const int order) const override;
 };
 
 template <typename T, typename K, typename series_templ>
 shanks_transform_alternating<T, K, series_templ>::shanks_transform_alternating(const series_templ& series) : series_acceleration<T, K, series_templ>(series) {}
 
 template <typename T, typename K, typename series_templ>
-T shanks_transform_alternating<T, K, series_templ>::operator()(const K n, const int order) const
+T shanks_transform_alternating<T, K, series_templ>::evaluate(const K n, const int order) const
 {
-	if (n < 0)
-		throw std::domain_error("negative integer in the input");
-	else if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
-		return this->series->S_n(n);
+	thread_local std::vector<T> workspace;
+	SHANKS_COUNT(scratch_bytes, workspace_size(order) * sizeof(T)); // counted on every call, even if the buffer of the thread is reused
+	if (workspace.size() < workspace_size(order))
+		workspace.resize(workspace_size(order));
+	return evaluate(n, order, workspace);
+}
+
+template <typename T, typename K, typename series_templ>
+constexpr std::size_t shanks_transform_alternating<T, K, series_templ>::workspace_size(const int order)
+{
+	return order > 1 ? 2 * order - 1 : 0;
+}
+
+template <typename T, typename K, typename series_templ>
+T shanks_transform_alternating<T, K, series_templ>::evaluate(const K n, const int order, std::span<T> workspace) const
+{
+	if (order == 0) /*it is convenient to assume that transformation of order 0 is no transformation at all*/
+		return this->S_n(n);
 	else if (n < order || n == 0)
 		return DEF_UNDEFINED_SUM;
 	else if (order == 1)
 	{
-		const auto a_n = this->series->operator()(n);
-		const auto a_n_plus_1 = this->series->operator()(n + 1);
-		const auto result = std::fma(a_n * a_n_plus_1, 1 / (a_n - a_n_plus_1), this->series->S_n(n));
-		if (!std::isfinite(result))
-			throw std::overflow_error("division by zero");
+		const auto a_n = this->term(n);
+		const auto a_n_plus_1 = this->term(n + 1);
+		const auto result = series_math::fma(a_n * a_n_plus_1, 1 / (a_n - a_n_plus_1), this->S_n(n));
+		SHANKS_COUNT(divisions, 1);
+		SHANKS_COUNT(table_cells, 1);
 		return result;
 	}
 	else [[likely]] //n > order >= 1
 	{
-		std::vector<T> T_n(n + order, 0);
-		auto a_n = this->series->operator()(n - order);
-		auto a_n_plus_1 = this->series->operator()(n - order + 1);
-		for (int i = n - order + 1; i <= n + order - 1; ++i) // if we got to this branch then we know that n >= order - see previous branches
+		if (workspace.size() < workspace_size(order))
+			throw std::domain_error("the workspace is too small");
+		// workspace[k] holds the transformation at i = n - order + 1 + k, the window shrinks by one from both sides on every order
+		const K first = n - order + 1;
+		SHANKS_COUNT(divisions, 2 * order - 1);
+		SHANKS_COUNT(table_cells, 2 * order - 1);
+		auto partial_sum = this->S_n(first);
+		auto a_n_plus_1 = this->term(first);
+		for (int k = 0; k < 2 * order - 1; ++k) // if we got to this branch then we know that n >= order - see previous branches
 		{
-			a_n = this->series->operator()(i);
-			a_n_plus_1 = this->series->operator()(i + 1);
+			const auto a_n = a_n_plus_1;
+			a_n_plus_1 = this->term(first + k + 1);
 
 			// formula [6]
-			T_n[i] = std::fma(a_n * a_n_plus_1, 1 / (a_n - a_n_plus_1), this->series->S_n(n));
+			workspace[k] = series_math::fma(a_n * a_n_plus_1, 1 / (a_n - a_n_plus_1), partial_sum);
+			partial_sum += a_n_plus_1;
 		}
-		std::vector<T> T_n_plus_1(n + order, 0);
+		SHANKS_TRACE_SPAN("shanks levels");
 		T a, b, c;
 		for (int j = 2; j <= order; ++j)
 		{
-			for (int i = n - order + j; i <= n + order - j; ++i)
+			SHANKS_COUNT(divisions, 2 * (order - j) + 1);
+			SHANKS_COUNT(table_cells, 2 * (order - j) + 1);
+			b = workspace[j - 2];
+			for (int k = j - 1; k <= 2 * order - 1 - j; ++k)
 			{
-				a = T_n[i];
-				b = T_n[i - 1];
-				c = T_n[i + 1];
-				/*if (!std::isfinite(abs(2 * T_n[i] - T_n[i - 1] - T_n[i + 1])))
-					throw std::overflow_error("division by zero");*/
-					/*T_n_plus_1[i] = T_n[i] - (T_n[i] - T_n[i - 1]) * (T_n[i + 1] - T_n[i]) / (T_n[i + 1] - 2 * T_n[i] + T_n[i - 1]);
-					T_n_plus_1[i] = std::fma(std::fma(T_n[i], T_n[i+1] + T_n[i-1] - T_n[i], -T_n[i-1]*T_n[i+1]), 1 / (2 * T_n[i] - T_n[i - 1] - T_n[i+1]), T_n[i]);*/
-				T_n_plus_1[i] = std::fma(std::fma(a, c + b - a, -b * c), 1 / (2 * a - b - c), a);
+				a = workspace[k];
+				c = workspace[k + 1];
+				workspace[k] = series_math::fma(series_math::fma(a, c + b - a, -b * c), 1 / (2 * a - b - c), a);
+				b = a;
 			}
-			T_n = T_n_plus_1;
 		}
-		if (!isfinite(T_n[n]))
-			throw std::overflow_error("division by zero");
-		return T_n[n];
+		return workspace[order - 1];
 	}
-}
\ No newline at end of file
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<T> shanks_transform_alternating<T, K, series_templ>::sweep(const K N, const int order) const
+{
+	return std::move(sweep_orders(N, order)[order]);
+}
+
+template <typename T, typename K, typename series_templ>
+std::vector<std::vector<T>> shanks_transform_alternating<T, K, series_templ>::sweep_orders(const K N, const int max_order) const
+{
+	if (N < 0 || max_order < 0)
+		throw std::domain_error("negative integer in the input");
+	std::vector<std::vector<T>> result(max_order + 1, std::vector<T>(N, DEF_UNDEFINED_SUM));
+	if (N == 0)
+		return result;
+
+	const K last = N + max_order; // T_N of the highest order needs the terms up to a_{N+max_order}
+	std::vector<T> terms(last + 1);
+	std::vector<T> partial_sums(last + 1);
+	SHANKS_COUNT(scratch_bytes, ((max_order + 1) * N + 2 * (last + 1)) * sizeof(T)); // with the result
+	this->fill_terms_and_partial_sums(0, terms, partial_sums);
+
+	for (K n = 1; n <= N; ++n)
+		result[0][n - 1] = partial_sums[n];
+	if (max_order == 0)
+		return result;
+
+	std::vector<T> level(last, 0); // level[i] is the transformation of order j at i, it is valid for i from j to last - j
+	SHANKS_COUNT(scratch_bytes, last * sizeof(T));
+	SHANKS_COUNT(divisions, last - 1);
+	SHANKS_COUNT(table_cells, last - 1);
+	for (K i = 1; i < last; ++i)
+	{
+		const auto a_n = terms[i];
+		const auto a_n_plus_1 = terms[i + 1];
+
+		// formula [6]
+		level[i] = series_math::fma(a_n * a_n_plus_1, 1 / (a_n - a_n_plus_1), partial_sums[i]);
+	}
+
+	T a, b, c;
+	for (int order = 1; order <= max_order; ++order)
+	{
+		SHANKS_TRACE_SPAN("shanks level");
+		if (order > 1)
+		{
+			SHANKS_COUNT(divisions, last - 2 * order + 1);
+			SHANKS_COUNT(table_cells, last - 2 * order + 1);
+			b = level[order - 1];
+			for (K i = order; i <= last - order; ++i)
+			{
+				a = level[i];
+				c = level[i + 1];
+				level[i] = series_math::fma(series_math::fma(a, c + b - a, -b * c), 1 / (2 * a - b - c), a);
+				b = a;
+			}
+		}
+		for (K n = order; n <= N; ++n)
+			result[order][n - 1] = level[n];
+	}
+	return result;
+}
+
+template <typename T, typename K, typename series_templ>
+std::size_t shanks_transform_alternating<T, K, series_templ>::sweep_terms_required(const K N, const int order) const
+{
+	return static_cast<std::size_t>(this->terms_required(N, order));
+}
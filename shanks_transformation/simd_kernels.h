@@ -0,0 +1,266 @@
+/**
+ * @file simd_kernels.h
+ * @brief This file contains vectorized kernels used for the batched evaluation of the series terms
+ * The kernels use AVX-512 or AVX2 registers when the compiler targets them (e.g. -march=native) and scalar code otherwise
+ */
+
+#pragma once
+#include <array>   // Include the array library
+#include <cstddef> // Include the library which contains std::size_t
+#include <span>    // Include the span library
+#include <cmath>   // Include the cmath library for std::fma
+#include <cstdint> // Include the cstdint library for INT64_MIN
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/**
+* @brief Pack of SIMD lanes holding the values of type T
+* The generic version holds a single lane, it is used for the types that are not supported by vector registers (e.g. long double)
+* @tparam T The type of the values in the lanes
+*/
+template <typename T>
+struct simd_pack
+{
+	static constexpr std::size_t width = 1;
+	T v;
+
+	static simd_pack broadcast(T a) { return { a }; }
+	static simd_pack load(const T* p) { return { *p }; }
+	void store(T* p) const { *p = v; }
+	friend simd_pack operator+(simd_pack a, simd_pack b) { return { a.v + b.v }; }
+	friend simd_pack operator-(simd_pack a, simd_pack b) { return { a.v - b.v }; }
+	friend simd_pack operator-(simd_pack a) { return { -a.v }; }
+	friend simd_pack operator*(simd_pack a, simd_pack b) { return { a.v * b.v }; }
+	friend simd_pack operator/(simd_pack a, simd_pack b) { return { a.v / b.v }; }
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c) { return { std::fma(a.v, b.v, c.v) }; }
+};
+
+#if defined(__AVX512F__)
+template <>
+struct simd_pack<double>
+{
+	static constexpr std::size_t width = 8;
+	__m512d v;
+
+	static simd_pack broadcast(double a) { return { _mm512_set1_pd(a) }; }
+	static simd_pack load(const double* p) { return { _mm512_loadu_pd(p) }; }
+	void store(double* p) const { _mm512_storeu_pd(p, v); }
+	friend simd_pack operator+(simd_pack a, simd_pack b) { return { _mm512_add_pd(a.v, b.v) }; }
+	friend simd_pack operator-(simd_pack a, simd_pack b) { return { _mm512_sub_pd(a.v, b.v) }; }
+	// the sign is flipped bitwise: the compiler would fuse a product into 0 - a, and two_prod of double_double.h needs it rounded
+	friend simd_pack operator-(simd_pack a) { return { _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a.v), _mm512_set1_epi64(INT64_MIN))) }; }
+	friend simd_pack operator*(simd_pack a, simd_pack b) { return { _mm512_mul_pd(a.v, b.v) }; }
+	friend simd_pack operator/(simd_pack a, simd_pack b) { return { _mm512_div_pd(a.v, b.v) }; }
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c) { return { _mm512_fmadd_pd(a.v, b.v, c.v) }; }
+};
+
+template <>
+struct simd_pack<float>
+{
+	static constexpr std::size_t width = 16;
+	__m512 v;
+
+	static simd_pack broadcast(float a) { return { _mm512_set1_ps(a) }; }
+	static simd_pack load(const float* p) { return { _mm512_loadu_ps(p) }; }
+	void store(float* p) const { _mm512_storeu_ps(p, v); }
+	friend simd_pack operator+(simd_pack a, simd_pack b) { return { _mm512_add_ps(a.v, b.v) }; }
+	friend simd_pack operator-(simd_pack a, simd_pack b) { return { _mm512_sub_ps(a.v, b.v) }; }
+	friend simd_pack operator-(simd_pack a) { return { _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.v), _mm512_set1_epi32(INT32_MIN))) }; }
+	friend simd_pack operator*(simd_pack a, simd_pack b) { return { _mm512_mul_ps(a.v, b.v) }; }
+	friend simd_pack operator/(simd_pack a, simd_pack b) { return { _mm512_div_ps(a.v, b.v) }; }
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c) { return { _mm512_fmadd_ps(a.v, b.v, c.v) }; }
+};
+#elif defined(__AVX2__)
+template <>
+struct simd_pack<double>
+{
+	static constexpr std::size_t width = 4;
+	__m256d v;
+
+	static simd_pack broadcast(double a) { return { _mm256_set1_pd(a) }; }
+	static simd_pack load(const double* p) { return { _mm256_loadu_pd(p) }; }
+	void store(double* p) const { _mm256_storeu_pd(p, v); }
+	friend simd_pack operator+(simd_pack a, simd_pack b) { return { _mm256_add_pd(a.v, b.v) }; }
+	friend simd_pack operator-(simd_pack a, simd_pack b) { return { _mm256_sub_pd(a.v, b.v) }; }
+	// the sign is flipped bitwise: the compiler would fuse a product into 0 - a, and two_prod of double_double.h needs it rounded
+	friend simd_pack operator-(simd_pack a) { return { _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)) }; }
+	friend simd_pack operator*(simd_pack a, simd_pack b) { return { _mm256_mul_pd(a.v, b.v) }; }
+	friend simd_pack operator/(simd_pack a, simd_pack b) { return { _mm256_div_pd(a.v, b.v) }; }
+#if defined(__FMA__)
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c) { return { _mm256_fmadd_pd(a.v, b.v, c.v) }; }
+#else
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c)
+	{
+		alignas(32) double x[width], y[width], z[width];
+		a.store(x), b.store(y), c.store(z);
+		for (std::size_t j = 0; j < width; ++j)
+			x[j] = std::fma(x[j], y[j], z[j]); // the error-free kernels need the single rounding
+		return load(x);
+	}
+#endif
+};
+
+template <>
+struct simd_pack<float>
+{
+	static constexpr std::size_t width = 8;
+	__m256 v;
+
+	static simd_pack broadcast(float a) { return { _mm256_set1_ps(a) }; }
+	static simd_pack load(const float* p) { return { _mm256_loadu_ps(p) }; }
+	void store(float* p) const { _mm256_storeu_ps(p, v); }
+	friend simd_pack operator+(simd_pack a, simd_pack b) { return { _mm256_add_ps(a.v, b.v) }; }
+	friend simd_pack operator-(simd_pack a, simd_pack b) { return { _mm256_sub_ps(a.v, b.v) }; }
+	friend simd_pack operator-(simd_pack a) { return { _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)) }; }
+	friend simd_pack operator*(simd_pack a, simd_pack b) { return { _mm256_mul_ps(a.v, b.v) }; }
+	friend simd_pack operator/(simd_pack a, simd_pack b) { return { _mm256_div_ps(a.v, b.v) }; }
+#if defined(__FMA__)
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c) { return { _mm256_fmadd_ps(a.v, b.v, c.v) }; }
+#else
+	friend simd_pack fma(simd_pack a, simd_pack b, simd_pack c)
+	{
+		alignas(32) float x[width], y[width], z[width];
+		a.store(x), b.store(y), c.store(z);
+		for (std::size_t j = 0; j < width; ++j)
+			x[j] = std::fma(x[j], y[j], z[j]); // the error-free kernels need the single rounding
+		return load(x);
+	}
+#endif
+};
+#endif
+
+/**
+* @brief Makes the pack of lanes a, a + 1, ..., a + width - 1
+* @tparam T The type of the values in the lanes
+* @param a The value of the first lane
+*/
+template <typename T>
+inline simd_pack<T> simd_iota(T a)
+{
+	std::array<T, simd_pack<T>::width> lanes;
+	for (std::size_t j = 0; j < lanes.size(); ++j)
+		lanes[j] = a + static_cast<T>(j);
+	return simd_pack<T>::load(lanes.data());
+}
+
+/**
+* @brief Fills out with the geometric progression first, first * ratio, first * ratio^2, ...
+* After the first block every lane is multiplied by ratio^width, so the lanes do not depend on each other
+* @tparam T The type of the elements
+* @param first The first element of the progression
+* @param ratio The ratio of the progression
+* @param out The span to be filled
+*/
+template <typename T>
+void geometric_kernel(T first, T ratio, std::span<T> out)
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	const std::size_t size = out.size();
+	if (size == 0)
+		return;
+
+	out[0] = first;
+	std::size_t i = 1;
+	for (; i < size && i < width; ++i)
+		out[i] = out[i - 1] * ratio;
+
+	T ratio_width = 1;
+	for (std::size_t j = 0; j < width; ++j)
+		ratio_width *= ratio;
+	const auto step = pack::broadcast(ratio_width);
+	for (; i + width <= size; i += width)
+		(pack::load(&out[i - width]) * step).store(&out[i]);
+
+	for (; i < size; ++i)
+		out[i] = out[i - 1] * ratio;
+}
+
+/**
+* @brief Fills out with the terms a_n, a_{n+1}, ... of the exponent Maclaurin series, a_{m+1} = a_m * x / (m + 1)
+* Every lane advances by width terms at once: a_{m+width} = a_m * x / (m + 1) * ... * x / (m + width)
+* @tparam T The type of the elements
+* @param x The argument of the exponent
+* @param first The term a_n
+* @param n The number of the first term
+* @param out The span to be filled
+*/
+template <typename T>
+void exp_kernel(T x, T first, T n, std::span<T> out)
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	const std::size_t size = out.size();
+	if (size == 0)
+		return;
+
+	out[0] = first;
+	std::size_t i = 1;
+	for (; i < size && i < width; ++i)
+		out[i] = out[i - 1] * x / (n + static_cast<T>(i));
+
+	const auto x_lanes = pack::broadcast(x);
+	const auto one = pack::broadcast(1);
+	for (; i + width <= size; i += width)
+	{
+		auto m = simd_iota(n + static_cast<T>(i - width));
+		auto ratio = one;
+		for (std::size_t j = 0; j < width; ++j)
+		{
+			m = m + one;
+			ratio = ratio * x_lanes / m;
+		}
+		(pack::load(&out[i - width]) * ratio).store(&out[i]);
+	}
+
+	for (; i < size; ++i)
+		out[i] = out[i - 1] * x / (n + static_cast<T>(i));
+}
+
+/**
+* @brief Fills out with the terms of a numerical series numerator * (+-1)^k / ((p_1 * k + q_1) * ... * (p_F * k + q_F)), k = n, n + 1, ...
+* The denominators are multiplied out in the integers, as the term functions of the series do, and only then converted to T,
+* so the terms are bit-identical to the term function. The divisions are vectorized.
+* @tparam T The type of the elements, K The type of enumerating integer, F The number of linear factors in the denominator
+* @param numerator The numerator of the terms
+* @param alternating Whether the sign of the terms is (-1)^k
+* @param factors The pairs {p_j, q_j} of the linear factors in the denominator
+* @param n The number of the first term
+* @param out The span to be filled
+*/
+template <typename T, typename K, std::size_t F>
+void reciprocal_product_kernel(T numerator, bool alternating, const std::array<std::array<K, 2>, F>& factors, K n, std::span<T> out)
+{
+	using pack = simd_pack<T>;
+	constexpr std::size_t width = pack::width;
+	const std::size_t size = out.size();
+	using product_type = decltype(K() * K()); // the type of the integer products of the term functions, e.g. int for short
+	const auto denominator = [&factors](const K k)
+	{
+		product_type product = 1;
+		for (const auto& [p, q] : factors)
+			product *= p * k + q;
+		return static_cast<T>(product);
+	};
+
+	std::array<T, width> numerators;
+	std::array<T, width> denominators;
+	std::size_t i = 0;
+	for (; i + width <= size; i += width)
+	{
+		for (std::size_t j = 0; j < width; ++j)
+		{
+			const K k = n + static_cast<K>(i + j);
+			numerators[j] = alternating && k % 2 ? -numerator : numerator;
+			denominators[j] = denominator(k);
+		}
+		(pack::load(numerators.data()) / pack::load(denominators.data())).store(&out[i]);
+	}
+
+	for (; i < size; ++i)
+	{
+		const K k = n + static_cast<K>(i);
+		out[i] = (alternating && k % 2 ? -numerator : numerator) / denominator(k);
+	}
+}
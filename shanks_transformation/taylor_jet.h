@@ -0,0 +1,177 @@
+/**
+ * @file taylor_jet.h
+ * @brief This file contains the truncated Taylor series type: the arithmetic on it carries the derivatives of a function along with its value
+ */
+
+#pragma once
+#include <vector> // Include the vector library
+#include "instrumentation.h"
+
+/**
+ * @brief Truncated Taylor series c_0 + c_1 h + ... + c_d h^d of a function at a point.
+ * A function written with +, -, * and / and evaluated on the jet x + h returns its own jet f(x) + f'(x) h + ... + f^{(d)}(x) / d! h^d,
+ * so the derivatives of a closed-form term come out exactly up to the rounding, without finite differences.
+ * @tparam T The type of the coefficients
+ */
+template <typename T>
+class taylor_jet
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the jet x + h of the independent variable.
+   * @param x The point
+   * @param degree The degree d of the jet, the powers of h above it are dropped
+   */
+	taylor_jet(const T x, const std::size_t degree);
+
+	/**
+   * @brief The degree d of the jet
+   */
+	std::size_t degree() const;
+
+	/**
+   * @brief The coefficient of h^k, it is f^{(k)}(x) / k!
+   * @param k The power of h, at most degree()
+   */
+	const T& operator[](const std::size_t k) const;
+
+	taylor_jet& operator+=(const taylor_jet& other);
+	taylor_jet& operator-=(const taylor_jet& other);
+	taylor_jet& operator*=(const taylor_jet& other);
+	taylor_jet& operator/=(const taylor_jet& other);
+	taylor_jet& operator+=(const T& c);
+	taylor_jet& operator-=(const T& c);
+	taylor_jet& operator*=(const T& c);
+	taylor_jet& operator/=(const T& c);
+
+	friend taylor_jet operator-(taylor_jet a) { return a *= -1; }
+	friend taylor_jet operator+(taylor_jet a, const taylor_jet& b) { return a += b; }
+	friend taylor_jet operator-(taylor_jet a, const taylor_jet& b) { return a -= b; }
+	friend taylor_jet operator*(taylor_jet a, const taylor_jet& b) { return a *= b; }
+	friend taylor_jet operator/(taylor_jet a, const taylor_jet& b) { return a /= b; }
+	friend taylor_jet operator+(taylor_jet a, const T& c) { return a += c; }
+	friend taylor_jet operator-(taylor_jet a, const T& c) { return a -= c; }
+	friend taylor_jet operator*(taylor_jet a, const T& c) { return a *= c; }
+	friend taylor_jet operator/(taylor_jet a, const T& c) { return a /= c; }
+	friend taylor_jet operator+(const T& c, taylor_jet a) { return a += c; }
+	friend taylor_jet operator-(const T& c, const taylor_jet& a) { return -a + c; }
+	friend taylor_jet operator*(const T& c, taylor_jet a) { return a *= c; }
+	friend taylor_jet operator/(const T& c, const taylor_jet& a) { return constant(c, a.degree()) /= a; }
+
+private:
+	/**
+   * @brief The jet of a constant
+   */
+	static taylor_jet constant(const T c, const std::size_t degree);
+
+	/**
+   * @brief The coefficients c_0, ..., c_d
+   */
+	std::vector<T> coefficients;
+};
+
+template <typename T>
+taylor_jet<T>::taylor_jet(const T x, const std::size_t degree) : coefficients(degree + 1, 0)
+{
+	SHANKS_COUNT(scratch_bytes, (degree + 1) * sizeof(T));
+	coefficients[0] = x;
+	if (degree > 0)
+		coefficients[1] = 1;
+}
+
+template <typename T>
+taylor_jet<T> taylor_jet<T>::constant(const T c, const std::size_t degree)
+{
+	taylor_jet<T> jet(c, degree);
+	if (degree > 0)
+		jet.coefficients[1] = 0;
+	return jet;
+}
+
+template <typename T>
+std::size_t taylor_jet<T>::degree() const
+{
+	return coefficients.size() - 1;
+}
+
+template <typename T>
+const T& taylor_jet<T>::operator[](const std::size_t k) const
+{
+	return coefficients[k];
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator+=(const taylor_jet& other)
+{
+	for (std::size_t k = 0; k < coefficients.size(); ++k)
+		coefficients[k] += other.coefficients[k];
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator-=(const taylor_jet& other)
+{
+	for (std::size_t k = 0; k < coefficients.size(); ++k)
+		coefficients[k] -= other.coefficients[k];
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator*=(const taylor_jet& other)
+{
+	// the Cauchy product, the coefficients are updated from the highest one so that the lower ones are still the old ones
+	for (std::size_t k = coefficients.size(); k-- > 0;)
+	{
+		T c = coefficients[k] * other.coefficients[0];
+		for (std::size_t j = 1; j <= k; ++j)
+			c += coefficients[k - j] * other.coefficients[j];
+		coefficients[k] = c;
+	}
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator/=(const taylor_jet& other)
+{
+	// the quotient q solves q * other = *this: q_k = (c_k - sum_{j = 1}^{k} other_j q_{k - j}) / other_0
+	SHANKS_COUNT(divisions, coefficients.size());
+	for (std::size_t k = 0; k < coefficients.size(); ++k)
+	{
+		T c = coefficients[k];
+		for (std::size_t j = 1; j <= k; ++j)
+			c -= other.coefficients[j] * coefficients[k - j];
+		coefficients[k] = c / other.coefficients[0];
+	}
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator+=(const T& c)
+{
+	coefficients[0] += c;
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator-=(const T& c)
+{
+	coefficients[0] -= c;
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator*=(const T& c)
+{
+	for (auto& coefficient : coefficients)
+		coefficient *= c;
+	return *this;
+}
+
+template <typename T>
+taylor_jet<T>& taylor_jet<T>::operator/=(const T& c)
+{
+	SHANKS_COUNT(divisions, coefficients.size());
+	for (auto& coefficient : coefficients)
+		coefficient /= c;
+	return *this;
+}
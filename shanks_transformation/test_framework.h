@@ -6,58 +6,20 @@
 #pragma once
 #include <memory>
 #include <string> 
-#include <set>
-#include "shanks_transformation.h"
-#include "epsilon_algorithm.h"
+#include "series_factory.h"
+#include "autotuner.h"
 #include "test_functions.h"
 
-enum transformation_id_t {
-	null_transformation_id, 
-	shanks_transformation_id, 
-	epsilon_algorithm_id
-};
-enum series_id_t {
-	null_series_id, 
-	exp_series_id, 
-	cos_series_id, 
-	sin_series_id, 
-	cosh_series_id,
-	sinh_series_id, 
-	bin_series_id, 
-	four_arctan_series_id, 
-	ln1mx_series_id, 
-	mean_sinh_sin_series_id,
-	exp_squared_erf_series_id, 
-	xmb_Jb_two_series_id, 
-	half_asin_two_x_series_id,
-	inverse_1mx_series_id,
-	x_1mx_squared_series_id,
-	erf_series_id,
-	m_fact_1mx_mp1_inverse_series_id,
-	inverse_sqrt_1m4x_series_id,
-	one_twelfth_3x2_pi2_series_id,
-	x_twelfth_x2_pi2_series_id,
-	ln2_series_id,
-	one_series_id,
-	minus_one_quarter_series_id,
-	pi_3_series_id,
-	pi_4_series_id,
-	pi_squared_6_minus_one_series_id,
-	three_minus_pi_series_id,
-	one_twelfth_series_id,
-	eighth_pi_m_one_third_series_id,
-	one_third_pi_squared_m_nine_series_id,
-	four_ln2_m_3_series_id,
-	exp_m_cos_x_sinsin_x_series_id
-};
-
 enum test_function_id_t {
 	null_test_function_id, 
 	cmp_sum_and_transform_id, 
 	cmp_a_n_and_transform_id, 
 	transformation_remainder_id, 
 	cmp_transformations_id,
-	eval_transform_time_id
+	eval_transform_time_id,
+	sum_with_tolerance_id,
+	grid_scaling_id,
+	cmp_batch_and_transform_id
 };
 
 /**
@@ -109,8 +71,43 @@ inline static void print_transformation_info()
 {
 	std::cout << "Which transformation would you like to test?" << std::endl <<
 		"List of currently avaiable series:" << std::endl <<
+		"0 - Choose the transformation and its order automatically" << std::endl <<
 		"1 - Shanks Transformation" << std::endl <<
-		"2 - Epsilon Algorithm" << std::endl;
+		"2 - Epsilon Algorithm" << std::endl <<
+		"3 - Levin u-transformation" << std::endl <<
+		"4 - Levin t-transformation" << std::endl <<
+		"5 - Levin v-transformation" << std::endl <<
+		"6 - Richardson Extrapolation" << std::endl <<
+		"7 - Cohen-Villegas-Zagier Algorithm (alternating series only)" << std::endl <<
+		"8 - Rho Algorithm" << std::endl <<
+		"9 - Theta Algorithm" << std::endl <<
+		"10 - Euler-Maclaurin Summation (numerical series with a rational term only)" << std::endl;
+}
+
+/**
+* @brief Chooses the cheapest transformation and order that reach the tolerance, see autotuner
+* @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+* @param series The series to be accelerated
+* @param alternating Whether the series is alternating
+* @param tolerance The requested tolerance
+* @return The choice of the autotuner
+*/
+template <typename T, typename K, typename series_templ>
+inline static autotune_result<T, K> autotune_transformation(const series_templ& series, const bool alternating, const T tolerance)
+{
+	autotuner<T, K, series_templ> tuner(tolerance);
+	for (int id = transformation_id_t::shanks_transformation_id; id <= transformation_id_t::euler_maclaurin_algorithm_id; ++id)
+	{
+		try
+		{
+			tuner.add_candidate(id, make_transformation<T, K>(id, series, alternating));
+		}
+		catch (std::domain_error&) {} // the transformation is not applicable to the series
+	}
+	const auto choice = tuner();
+	if (choice.transformation_id == transformation_id_t::null_transformation_id)
+		throw std::domain_error("no transformation is applicable to the series");
+	return choice;
 }
 
 /**
@@ -125,22 +122,26 @@ inline static void print_test_function_info()
 		"2 - cmp_a_n_and_transform - showcases the difference between series' terms and transformed ones" << std::endl <<
 		"3 - transformation_remainders - showcases the difference between series' sum and transformed partial sum" << std::endl <<
 		"4 - cmp_transformations - showcases the difference between convergence of sums accelerated by different transformations" << std::endl <<
-		"5 - eval_transform_time - evaluates the time it takes to transform series" << std::endl;
+		"5 - eval_transform_time - evaluates the time it takes to transform series" << std::endl <<
+		"6 - sum_with_tolerance - sums the series until the transformed partial sums agree within the tolerance, n is the limit on the terms" << std::endl <<
+		"7 - grid_scaling - evaluates T_1, ..., T_n of the orders 0, ..., order in all the floating types on 1, 2, ... threads and the time it takes" << std::endl <<
+		"8 - cmp_batch_and_transform - compares the Shanks transformation and the Epsilon Algorithm of a batch of arguments up to x with the scalar ones (exp, bin, four_arctan and erf series)" << std::endl;
 }
 
 /**
 * @brief The main testing function
 * This function provides a convenient and interactive way to test out the convergence acceleration of various series
-* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @tparam T The type the transformations are computed in, K The type of enumerating integer,
+* term_type The type the terms of the series are computed in, it may be narrower than T (e.g. double terms with long double transformations)
 * @authors Bolshakov M.P.
 */
-template <typename T, typename K>
+template <typename T, typename K, typename term_type = T>
 inline static void main_testing_function()
 {
 
 	//choosing series
 	print_series_info();
-	std::unique_ptr<series_base<T, K>> series;
+	std::unique_ptr<series_base<term_type, K>> series;
 	int series_id = 0;
 	std::cin >> series_id;
 
@@ -150,143 +151,61 @@ inline static void main_testing_function()
 	std::cin >> x;
 
 	//choosing series (cont.)
-	std::set<int> alternating_series = { 2, 3, 7, 11, 15, 18, 19, 20, 21, 24, 26, 28, 30, 31};
+	T alpha = 0;
+	K b = 0;
+	K m = 0;
 	switch (series_id)
 	{
-	case series_id_t::exp_series_id:
-		series.reset(new exp_series<T, K>(x));
-		break;
-	case series_id_t::cos_series_id:
-		series.reset(new cos_series<T, K>(x));
-		break;
-	case series_id_t::sin_series_id:
-		series.reset(new sin_series<T, K>(x));
-		break;
-	case series_id_t::cosh_series_id:
-		series.reset(new cosh_series<T, K>(x));
-		break;
-	case series_id_t::sinh_series_id:
-		series.reset(new sinh_series<T, K>(x));
-		break;
 	case series_id_t::bin_series_id:
-		T alpha;
 		std::cout << "Enter the value for constant alpha for the series" << std::endl;
 		std::cin >> alpha;
-		series.reset(new bin_series<T, K>(x, alpha));
-		break;
-	case series_id_t::four_arctan_series_id:
-		series.reset(new four_arctan_series<T, K>(x));
-		break;
-	case series_id_t::ln1mx_series_id:
-		series.reset(new ln1mx_series<T, K>(x));
-		break;
-	case series_id_t::mean_sinh_sin_series_id:
-		series.reset(new mean_sinh_sin_series<T, K>(x));
-		break;
-	case series_id_t::exp_squared_erf_series_id:
-		series.reset(new exp_squared_erf_series<T, K>(x));
 		break;
 	case series_id_t::xmb_Jb_two_series_id:
-		K b;
 		std::cout << "Enter the value for constant b for the series" << std::endl;
 		std::cin >> b;
-		series.reset(new xmb_Jb_two_series<T, K>(x, b));
-		break;
-	case series_id_t::half_asin_two_x_series_id:
-		series.reset(new half_asin_two_x_series<T, K>(x));
-		break;
-	case series_id_t::inverse_1mx_series_id:
-		series.reset(new inverse_1mx_series<T, K>(x));
-		break;
-	case series_id_t::x_1mx_squared_series_id:
-		series.reset(new x_1mx_squared_series<T, K>(x));
-		break;
-	case series_id_t::erf_series_id:
-		series.reset(new erf_series<T, K>(x));
 		break;
 	case series_id_t::m_fact_1mx_mp1_inverse_series_id:
-		T m;
 		std::cout << "Enter the value for constant m for the series" << std::endl;
 		std::cin >> m;
-		series.reset(new m_fact_1mx_mp1_inverse_series<T, K>(x, m));
-		break;
-	case series_id_t::inverse_sqrt_1m4x_series_id:
-		series.reset(new inverse_sqrt_1m4x_series<T, K>(x));
-		break;
-	case series_id_t::one_twelfth_3x2_pi2_series_id:
-		series.reset(new one_twelfth_3x2_pi2_series<T, K>(x));
-		break; 
-	case series_id_t::x_twelfth_x2_pi2_series_id:
-		series.reset(new x_twelfth_x2_pi2_series<T, K>(x));
-		break;
-	case series_id_t::ln2_series_id:
-		series.reset(new ln2_series<T, K>());
-		break;
-	case series_id_t::one_series_id:
-		series.reset(new one_series<T, K>());
 		break;
-	case series_id_t::minus_one_quarter_series_id:
-		series.reset(new minus_one_quarter_series<T, K>());
-		break;
-	case series_id_t::pi_3_series_id:
-		series.reset(new pi_3_series<T, K>());
-		break;
-	case series_id_t::pi_4_series_id:
-		series.reset(new pi_4_series<T, K>());
-		break;
-	case series_id_t::pi_squared_6_minus_one_series_id:
-		series.reset(new pi_squared_6_minus_one_series<T, K>());
-		break;
-	case series_id_t::three_minus_pi_series_id:
-		series.reset(new three_minus_pi_series<T, K>());
-		break;
-	case series_id_t::one_twelfth_series_id:
-		series.reset(new one_twelfth_series<T, K>());
-		break;
-	case series_id_t::eighth_pi_m_one_third_series_id:
-		series.reset(new eighth_pi_m_one_third_series<T, K>());
-		break;
-	case series_id_t::one_third_pi_squared_m_nine_series_id:
-		series.reset(new one_third_pi_squared_m_nine_series<T, K>());
-		break;
-	case series_id_t::four_ln2_m_3_series_id:
-		series.reset(new four_ln2_m_3_series<T, K>());
-		break;
-	case series_id_t::exp_m_cos_x_sinsin_x_series_id:
-		series.reset(new exp_m_cos_x_sinsin_x_series<T, K>(x));
-		break;
-	default:
-		throw std::domain_error("wrong series_id");
 	}
+	series = make_series<term_type, K>(series_id, static_cast<term_type>(x), static_cast<term_type>(alpha), b, m);
+	series->enable_partial_sum_cache(); // the testing functions query S_n for every i up to n
 
 	//choosing transformation
 	print_transformation_info();
 	int transformation_id = 0;
 	std::cin >> transformation_id;
-	std::unique_ptr<series_acceleration<T, K, decltype(series.get())>> transform;
-	switch (transformation_id)
+	int order = 0;
+	const bool autotuned = transformation_id == transformation_id_t::null_transformation_id;
+	if (autotuned)
 	{
-	case transformation_id_t::shanks_transformation_id:
-		if (alternating_series.contains(series_id))
-			transform.reset(new shanks_transform_alternating<T, K, decltype(series.get())>(series.get()));
-		else
-			transform.reset(new shanks_transform<T, K, decltype(series.get())>(series.get()));
-		break;
-	case transformation_id_t::epsilon_algorithm_id:
-		transform.reset(new epsilon_algorithm<T, K, decltype(series.get())>(series.get()));
-		break;
-	default:
-		throw std::domain_error("wrong transformation_id");
+		std::cout << "Enter the tolerance" << std::endl;
+		T tolerance = 0;
+		std::cin >> tolerance;
+		const auto choice = autotune_transformation<T, K>(series.get(), is_alternating_series(series_id), tolerance);
+		transformation_id = choice.transformation_id;
+		order = choice.order;
+		std::cout << "Chosen transformation " << transformation_id << " of order " << order << (choice.converged ? "" : " (the tolerance is not reached)") << std::endl;
+		std::cout << "T_" << choice.n << " : " << choice.estimate << ", error estimate : " << choice.error_estimate << ", cost : " << choice.cost << std::endl;
 	}
+	auto transform = make_transformation<T, K>(transformation_id, series.get(), is_alternating_series(series_id));
 
 	//choosing testing function
 	print_test_function_info();
 	int function_id = 0;
 	std::cin >> function_id;
 	int n = 0;
-	int order = 0;
-	std::cout << "Enter n and order:" << std::endl;
-	std::cin >> n >> order;
+	if (autotuned)
+	{
+		std::cout << "Enter n:" << std::endl;
+		std::cin >> n;
+	}
+	else
+	{
+		std::cout << "Enter n and order:" << std::endl;
+		std::cin >> n >> order;
+	}
 	switch (function_id)
 	{
 	case test_function_id_t::cmp_sum_and_transform_id:
@@ -300,23 +219,39 @@ inline static void main_testing_function()
 		break;
 	case test_function_id_t::cmp_transformations_id:
 	{
-		/*std::cout << "choose the type of the other";*/ //so far we've only got 2 transformations
-		std::unique_ptr<series_acceleration<T, K, decltype(series.get())>> transform2;
-		if (transformation_id == 1)
-			transform2.reset(new epsilon_algorithm<T, K, decltype(series.get())>(series.get()));
-		else //transformation_id is 2
-		{
-			if (alternating_series.contains(series_id))
-				transform2.reset(new shanks_transform_alternating<T, K, decltype(series.get())>(series.get()));
-			else
-				transform2.reset(new shanks_transform<T, K, decltype(series.get())>(series.get()));
-		}
+		std::cout << "Choose the transformation to compare with" << std::endl;
+		print_transformation_info();
+		int transformation_id_2 = 0;
+		std::cin >> transformation_id_2;
+		auto transform2 = make_transformation<T, K>(transformation_id_2, series.get(), is_alternating_series(series_id));
 		cmp_transformations(n, order, std::move(series.get()), std::move(transform.get()), std::move(transform2.get()));
 		break;
 	}
 	case test_function_id_t::eval_transform_time_id:
 		eval_transform_time(n, order, std::move(series.get()), std::move(transform.get()));
 		break;
+	case test_function_id_t::sum_with_tolerance_id:
+	{
+		std::cout << "Enter the tolerance" << std::endl;
+		T tolerance = 0;
+		std::cin >> tolerance;
+		sum_with_tolerance(n, order, tolerance, std::move(series.get()), std::move(transform.get()));
+		break;
+	}
+	case test_function_id_t::grid_scaling_id:
+	{
+		std::vector<K> ns(n);
+		std::iota(ns.begin(), ns.end(), 1);
+		std::vector<int> orders(order + 1);
+		std::iota(orders.begin(), orders.end(), 0);
+		const auto jobs = make_grid<K>({ series_id }, { static_cast<long double>(x) }, ns, orders, { transformation_id },
+			{ grid_type_id::float_type, grid_type_id::double_type, grid_type_id::long_double_type, grid_type_id::double_double_type }, static_cast<long double>(alpha), b, m);
+		eval_grid_scaling(jobs, std::max(std::thread::hardware_concurrency(), 1u));
+		break;
+	}
+	case test_function_id_t::cmp_batch_and_transform_id:
+		cmp_batch_and_transform<T, K>(n, order, series_id, x, alpha);
+		break;
 	default:
 		throw std::domain_error("wrong function_id");
 	}
@@ -8,8 +8,34 @@
 #include "test_functions.h"
 #include "series_acceleration.h"
 #include "series.h"
+#include "convergence_driver.h"
+#include "grid_runner.h"
+#include "benchmark.h"
+#include "batch_acceleration.h"
 #include <chrono>
 
+/**
+* @brief The message printed instead of a transformed partial sum that failed, see eval_status
+* @param status The status of the transformed partial sum
+* @return The message
+*/
+inline std::string eval_status_message(const eval_status status)
+{
+	switch (status)
+	{
+	case eval_status::ok:
+		return "ok";
+	case eval_status::non_finite:
+		return "division by zero";
+	case eval_status::invalid_argument:
+		return "invalid argument";
+	case eval_status::overflow:
+		return "overflow";
+	default:
+		return "failure";
+	}
+}
+
 /*
 * @brief Function that prints out comparesment between transformed and nontransformed partial sums
 * At first it prints out the type of transformation, series that are being transformed, type of enumerating integer and type of series terms
@@ -27,23 +53,19 @@ template <typename series_templ, typename transform_type>
 void cmp_sum_and_transform(const int n, const int order, const series_templ&& series, const transform_type&& test)
 {
 	test->print_info();
-	for (int i = 1; i <= n; ++i)
+	const auto transformed = test->try_sweep(n, order); // T_1, ..., T_n in one pass, the failures are marked instead of thrown
+	SHANKS_TRACE_SPAN("output");
+	for (int i = 1; i <= static_cast<int>(transformed.size()); ++i)
 	{
-		try
+		std::cout << "S_" << i << " : " << series->S_n(i) << std::endl;
+		if (!transformed[i - 1].ok())
 		{
-			std::cout << "S_" << i << " : " << series->S_n(i) << std::endl;
-			std::cout << "T_" << i << " of order " << order << " : " << test->operator()(i, order) << std::endl;
-			std::cout << "T_" << i << " of order " << order << " - S_" << i
-				<< " : " << test->operator()(i, order) - series->S_n(i) << std::endl;
-		}
-		catch (std::domain_error& e)
-		{
-			std::cout << e.what() << std::endl;
-		}
-		catch (std::overflow_error& e)
-		{
-			std::cout << e.what() << std::endl;
+			std::cout << eval_status_message(transformed[i - 1].status) << std::endl;
+			continue;
 		}
+		std::cout << "T_" << i << " of order " << order << " : " << transformed[i - 1].value << std::endl;
+		std::cout << "T_" << i << " of order " << order << " - S_" << i
+			<< " : " << transformed[i - 1].value - series->S_n(i) << std::endl;
 	}
 }
 
@@ -63,23 +85,22 @@ template <typename series_templ, typename transform_type>
 void cmp_a_n_and_transform(const int n, const int order, const series_templ&& series, const transform_type&& test)
 {
 	test->print_info();
-	for (int i = 1; i <= n; ++i)
+	const auto transformed = test->try_sweep(n, order); // T_1, ..., T_n in one pass, the failures are marked instead of thrown
+	auto previous = test->try_eval(0, order);
+	SHANKS_TRACE_SPAN("output");
+	for (int i = 1; i <= static_cast<int>(transformed.size()); ++i)
 	{
-		try
+		const auto current = transformed[i - 1];
+		std::cout << "a_" << i << " : " << (*series)(i) << std::endl;
+		if (!previous.ok() || !current.ok())
+			std::cout << eval_status_message(previous.ok() ? current.status : previous.status) << std::endl;
+		else
 		{
-			std::cout << "a_" << i << " : " << (*series)(i) << std::endl;
-			std::cout << "t_" << i << " : " << test->operator()(i, order) - test->operator()(i - 1, order) << std::endl;
+			std::cout << "t_" << i << " : " << current.value - previous.value << std::endl;
 			std::cout << "t_" << i << " of order " << order << " - a_" << i
-				<< " : " << (test->operator()(i, order) - test->operator()(i - 1, order)) - (*series)(i) << std::endl;
-		}
-		catch (std::domain_error& e)
-		{
-			std::cout << e.what() << std::endl;
-		}
-		catch (std::overflow_error& e)
-		{
-			std::cout << e.what() << std::endl;
+				<< " : " << (current.value - previous.value) - (*series)(i) << std::endl;
 		}
+		previous = current;
 	}
 }
 
@@ -99,20 +120,14 @@ void transformation_remainders(const int n, const int order, const series_templ&
 {
 	std::cout << "Tranformation of order " << order << " remainders from i = 1 to " << n << std::endl;
 	test->print_info();
-	for (int i = 1; i <= n; ++i)
+	const auto transformed = test->try_sweep(n, order); // T_1, ..., T_n in one pass, the failures are marked instead of thrown
+	SHANKS_TRACE_SPAN("output");
+	for (int i = 1; i <= static_cast<int>(transformed.size()); ++i)
 	{
-		try
-		{
-			std::cout << "S - T_" << i << " : " << series->get_sum() - test->operator()(i, order) << std::endl;
-		}
-		catch (std::domain_error& e)
-		{
-			std::cout << e.what() << std::endl;
-		}
-		catch (std::overflow_error& e)
-		{
-			std::cout << e.what() << std::endl;
-		}
+		if (transformed[i - 1].ok())
+			std::cout << "S - T_" << i << " : " << series->get_sum() - transformed[i - 1].value << std::endl;
+		else
+			std::cout << eval_status_message(transformed[i - 1].status) << std::endl;
 	}
 }
 
@@ -136,34 +151,33 @@ void cmp_transformations(const int n, const int order, const series_templ&& seri
 	test_1->print_info();
 	std::cout << "The transformation #2 is ";
 	test_2->print_info();
-	auto diff_1 = (*series)(0);
-	auto diff_2 = (*series)(0);
-	for (int i = 1; i <= n; ++i)
+	const auto transformed_1 = test_1->try_sweep(n, order); // the failures are marked instead of thrown
+	const auto transformed_2 = test_2->try_sweep(n, order);
+	SHANKS_TRACE_SPAN("output");
+	for (int i = 1; i <= static_cast<int>(std::min(transformed_1.size(), transformed_2.size())); ++i)
 	{
-		try
-		{
-			diff_1 = series->get_sum() - test_1->operator()(i, order);
-			diff_2 = series->get_sum() - test_2->operator()(i, order);
-			std::cout << "The transformation #1: S - T_" << i << " : " << diff_1 << std::endl;
-			std::cout << "The transformation #2: S - T_" << i << " : " << diff_2 << std::endl;
-			if (std::abs(diff_1) < std::abs(diff_2))
-				std::cout << "The transformation #1 is faster" << std::endl;
-			else
-				std::cout << "The transformation #2 is faster" << std::endl;
-		}
-		catch (std::domain_error& e)
+		if (!transformed_1[i - 1].ok() || !transformed_2[i - 1].ok())
 		{
-			std::cout << e.what() << std::endl;
-		}
-		catch (std::overflow_error& e)
-		{
-			std::cout << e.what() << std::endl;
+			if (!transformed_1[i - 1].ok())
+				std::cout << "The transformation #1: " << eval_status_message(transformed_1[i - 1].status) << std::endl;
+			if (!transformed_2[i - 1].ok())
+				std::cout << "The transformation #2: " << eval_status_message(transformed_2[i - 1].status) << std::endl;
+			continue;
 		}
+		const auto diff_1 = series->get_sum() - transformed_1[i - 1].value;
+		const auto diff_2 = series->get_sum() - transformed_2[i - 1].value;
+		std::cout << "The transformation #1: S - T_" << i << " : " << diff_1 << std::endl;
+		std::cout << "The transformation #2: S - T_" << i << " : " << diff_2 << std::endl;
+		if (series_math::abs(diff_1) < series_math::abs(diff_2))
+			std::cout << "The transformation #1 is faster" << std::endl;
+		else
+			std::cout << "The transformation #2 is faster" << std::endl;
 	}
 }
 
 /**
 * @brief Function that evaluates the time it takes to transform series
+* It measures one sweep that computes the transformed partial sums T_1, ..., T_n with warmups and repetitions, see measure
 * @authors Bolshakov M.P.
 * @tparam series_templ is the type of series whose convergence we accelerate, transform_type is the type of transformation we are using
 * @param n The number of terms for the last remainder
@@ -172,26 +186,112 @@ void cmp_transformations(const int n, const int order, const series_templ&& seri
 * @param test The type of the first transformation that is being used
 */
 template <typename series_templ, typename transform_type>
-void eval_transform_time(const int n, const int order, const series_templ&& series, const transform_type&& test)
+void eval_transform_time(const int n, const int order, [[maybe_unused]] const series_templ&& series, const transform_type&& test)
 {
-	const auto start_time = std::chrono::system_clock::now();
 	test->print_info();
-	for (int i = 1; i <= n; ++i)
+	const benchmark_options options;
+	eval_status status = eval_status::ok;
+	const auto time = measure([&]
 	{
-		try
-		{
-			test->operator()(i, order);
-		}
-		catch (std::domain_error& e)
-		{
-			std::cout << e.what() << std::endl;
-		}
-		catch (std::overflow_error& e)
+		const auto transformed = test->try_sweep(n, order); // T_1, ..., T_n in one pass, the failures are marked instead of thrown
+		if (transformed.empty())
+			return 0.0;
+		status = transformed.back().status;
+		return static_cast<double>(transformed.back().value);
+	}, options);
+	if (status != eval_status::ok)
+		std::cout << "T_" << n << " of order " << order << " : " << eval_status_message(status) << std::endl;
+	std::cout << "It took " << time.median / 1e6 << " ms to perform these transformations (the median of " << time.samples
+		<< " runs, the 95th percentile is " << time.p95 / 1e6 << " ms)" << std::endl;
+}
+
+/**
+* @brief Function that sums the series up to the tolerance with sum_until_converged
+* It prints out the accelerated sum, its error estimate, the number of terms it depends on, the work spent and the actual error
+* @tparam T The type of the elements in the series, series_templ is the type of series whose convergence we accelerate, transform_type is the type of transformation we are using
+* @param n The largest number of terms of the transformed partial sum
+* @param order The order of the transformation
+* @param tolerance The requested tolerance
+* @param series The series class object to be accelerated
+* @param test The type of transformation that is being used
+*/
+template <typename T, typename series_templ, typename transform_type>
+void sum_with_tolerance(const int n, const int order, const T tolerance, const series_templ&& series, const transform_type&& test)
+{
+	test->print_info();
+	const auto result = sum_until_converged(*test, tolerance, order, n, std::min(n, 16));
+	std::cout << (result.converged ? "The tolerance is reached" : "The tolerance is not reached") << std::endl;
+	std::cout << "sum : " << result.value << std::endl;
+	std::cout << "error estimate : " << result.error_estimate << std::endl;
+	std::cout << "terms used : " << result.terms_used << std::endl;
+	std::cout << "terms evaluated : " << result.work << std::endl;
+	std::cout << "S - sum : " << series->get_sum() - result.value << std::endl;
+}
+
+/**
+* @brief Function that runs the grid of the jobs on 1, 2, ..., max_threads threads
+* It prints out the number of threads, the wall time, the speedup over a single thread and whether the results match the ones on a single thread
+* @tparam K The type of enumerating integer
+* @param jobs The jobs of the grid
+* @param max_threads The largest number of threads
+*/
+template <typename K>
+void eval_grid_scaling(const std::vector<grid_job<K>>& jobs, const unsigned max_threads)
+{
+	std::cout << "The grid of " << jobs.size() << " jobs" << std::endl;
+	const auto timings = grid_scaling(jobs, max_threads);
+	for (const auto& timing : timings)
+		std::cout << timing.threads << " threads : " << timing.milliseconds << " ms, speedup : " << timings.front().milliseconds / timing.milliseconds
+			<< (timing.identical ? "" : ", the results differ") << std::endl;
+}
+
+/**
+* @brief Function that compares the transformations of a batch with the scalar ones
+* The batch holds tile_lanes + 8 arguments spread evenly up to x, so that its last tile is short.
+* For the Shanks transformation and the Epsilon Algorithm it prints out the largest relative difference between the batch and the scalar transformation
+* and the argument where it is reached. The lanes that are not finite in the batch or in the scalar transformation are only counted:
+* the Shanks transformation divides by almost zero once the terms are tiny, so the rounding of the terms decides between a value and a division by zero
+* @tparam T The type of the elements in the series, K The type of enumerating integer
+* @param n The number of terms
+* @param order The order of the transformation
+* @param series_id The id of the series, see make_series_batch
+* @param x The largest argument
+* @param alpha The constant alpha of bin_series
+*/
+template <typename T, typename K>
+void cmp_batch_and_transform(const int n, const int order, const int series_id, const T x, const T alpha)
+{
+	const std::size_t lanes = series_batch<T, K>::tile_lanes + 8;
+	std::vector<T> arguments(lanes);
+	for (std::size_t j = 0; j < lanes; ++j)
+		arguments[j] = x * static_cast<T>(j + 1) / static_cast<T>(lanes);
+	const auto batch = make_series_batch<T, K>(series_id, arguments, alpha);
+	const std::vector<T> batch_results[] = { shanks_transform_batch<T, K>(*batch)(n, order), epsilon_algorithm_batch<T, K>(*batch)(n, order) };
+	const int transformation_ids[] = { transformation_id_t::shanks_transformation_id, transformation_id_t::epsilon_algorithm_id };
+	SHANKS_TRACE_SPAN("output");
+	for (int t = 0; t < 2; ++t)
+	{
+		T largest = 0;
+		std::size_t largest_lane = 0;
+		std::size_t not_finite = 0;
+		for (std::size_t j = 0; j < lanes; ++j)
 		{
-			std::cout << e.what() << std::endl;
+			const auto series = make_series<T, K>(series_id, arguments[j], alpha);
+			const T scalar = make_transformation<T, K>(transformation_ids[t], series.get(), false)->evaluate(n, order);
+			const T vector = batch_results[t][j];
+			if (!series_math::isfinite(scalar) || !series_math::isfinite(vector))
+			{
+				++not_finite;
+				continue;
+			}
+			const T difference = series_math::abs(vector - scalar) / std::max<T>(1, series_math::abs(scalar));
+			if (difference > largest)
+			{
+				largest = difference;
+				largest_lane = j;
+			}
 		}
+		std::cout << (t == 0 ? "Shanks transformation" : "Epsilon Algorithm") << " of the batch of " << lanes << " arguments: the largest relative difference from the scalar one is "
+			<< largest << " at x = " << arguments[largest_lane] << ", the lanes that are not finite : " << not_finite << std::endl;
 	}
-	const auto end_time = std::chrono::system_clock::now();
-	const std::chrono::duration<double, std::milli> diff = end_time - start_time;
-	std::cout << "It took " << diff.count() << " to perform these transformations" << std::endl;
-}
\ No newline at end of file
+}
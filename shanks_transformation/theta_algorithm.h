@@ -0,0 +1,52 @@
+/**
+ * @file theta_algorithm.h
+ * @brief This file contains the declaration of the Theta Algorithm class.
+ */
+
+#pragma once
+
+#include "lozenge_table.h" // Include the lozenge table engine
+
+/**
+ * @brief The recurrence of Brezinski's Theta Algorithm for lozenge_table.
+ * theta_{2k+1}^{(n)} = theta_{2k-1}^{(n+1)} + 1 / (theta_{2k}^{(n+1)} - theta_{2k}^{(n)}),
+ * theta_{2k+2}^{(n)} = theta_{2k}^{(n+1)} + (theta_{2k}^{(n+2)} - theta_{2k}^{(n+1)}) * (theta_{2k+1}^{(n+2)} - theta_{2k+1}^{(n+1)}) / (theta_{2k+1}^{(n+2)} - 2 * theta_{2k+1}^{(n+1)} + theta_{2k+1}^{(n)}).
+ * The even columns need two steps more than the odd ones, so the column c is skewed by c + c / 2 and the recurrence looks at three diagonals.
+ * For more information, see p. 10.1 in [E.J. Weniger, Nonlinear sequence transformations for the acceleration of convergence and the summation of divergent series]
+ * @tparam T The type of the entries of the table
+ */
+template <typename T>
+struct theta_rule
+{
+	static constexpr std::size_t depth = 3;
+
+	static constexpr std::size_t shift(const std::size_t c) { return c + c / 2; }
+
+	static T entry(const std::size_t c, const T* current, const T* previous, const T* before_previous)
+	{
+		if (c % 2)
+			return before_previous[c - 2] + 1 / (current[c - 1] - previous[c - 1]);
+		return before_previous[c - 2] + (previous[c - 2] - before_previous[c - 2]) * (current[c - 1] - previous[c - 1]) /
+			(current[c - 1] - 2 * previous[c - 1] + before_previous[c - 1]);
+	}
+};
+
+/**
+ * @brief Theta Algorithm class template.
+ * It accelerates both the linearly and the logarithmically convergent series, which makes it suitable for the mixed cases.
+ * T_n of the order k is theta_{2k}^{(n-1)}, it depends on the partial sums S_{n-1}, ..., S_{n-1+3k}.
+ * @tparam T The type of the elements in the series, K The type of enumerating integer, series_templ is the type of series whose convergence we accelerate
+ */
+template <typename T, typename K, typename series_templ>
+class theta_algorithm : public lozenge_algorithm<T, K, series_templ, theta_rule<T>>
+{
+public:
+	/**
+   * @brief Parameterized constructor to initialize the Theta Algorithm.
+   * @param series The series class object to be accelerated
+   */
+	theta_algorithm(const series_templ& series);
+};
+
+template <typename T, typename K, typename series_templ>
+theta_algorithm<T, K, series_templ>::theta_algorithm(const series_templ& series) : lozenge_algorithm<T, K, series_templ, theta_rule<T>>(series) {}
@@ -0,0 +1,249 @@
+/**
+ * @file trace_events.h
+ * @brief This file contains the timeline of the phases of the computations: the scoped spans, e.g. the generation of the terms,
+ * the partial sums, the levels of the tables and the output of the results, written as a Chrome trace (chrome://tracing, ui.perfetto.dev).
+ * The spans are compiled in only when SHANKS_TRACING is defined (the CMake option of the same name), otherwise SHANKS_TRACE_SPAN
+ * expands to nothing. When compiled in, the spans are recorded between start_tracing and stop_tracing, and cost one atomic load otherwise.
+ */
+
+#pragma once
+#include <cstdint> // Include the cstdint library for std::int64_t
+#include <string> // Include the string library
+#include <ostream> // Include the ostream library
+#include <fstream> // Include the fstream library
+#include <vector> // Include the vector library
+#include <memory> // Include the memory library for std::unique_ptr
+#include <mutex> // Include the mutex library
+#include <atomic> // Include the atomic library
+#include <chrono> // Include the chrono library for std::chrono::steady_clock
+
+/**
+ * @brief A recorded span, the name and the category are string literals
+ */
+struct trace_event
+{
+	const char* name;
+	const char* category;
+	std::int64_t start_ns; // since the first use of the trace
+	std::int64_t duration_ns;
+};
+
+/**
+ * @brief The spans of one thread, only the thread itself appends to them, so the recording takes no lock
+ */
+struct trace_buffer
+{
+	std::uint32_t thread;
+	std::vector<trace_event> events;
+};
+
+/**
+ * @brief The buffers of all the threads that have recorded a span
+ */
+class trace_registry
+{
+public:
+	/**
+   * @brief The registry of the process
+   */
+	static trace_registry& instance();
+
+	/**
+   * @brief The buffer of the calling thread, it is registered on the first call and lives as long as the registry
+   */
+	trace_buffer& thread_buffer();
+
+	/**
+   * @brief The nanoseconds since the first use of the registry
+   */
+	std::int64_t now() const;
+
+	/**
+   * @brief Whether the spans are being recorded
+   */
+	std::atomic<bool> enabled = false;
+
+	/**
+   * @brief Writes the spans of all the threads in the Chrome trace event format.
+   * No thread may record spans meanwhile, e.g. it is called after the pool has finished.
+   * @param out The stream
+   */
+	void write(std::ostream& out);
+
+	/**
+   * @brief Forgets the recorded spans, no thread may record spans meanwhile
+   */
+	void clear();
+
+private:
+	trace_registry();
+
+	std::chrono::steady_clock::time_point epoch;
+	std::mutex mutex; // guards the list of the buffers, not their contents
+	std::vector<std::unique_ptr<trace_buffer>> buffers;
+};
+
+inline trace_registry::trace_registry() : epoch(std::chrono::steady_clock::now()) {}
+
+inline trace_registry& trace_registry::instance()
+{
+	static trace_registry registry;
+	return registry;
+}
+
+inline trace_buffer& trace_registry::thread_buffer()
+{
+	thread_local trace_buffer* buffer = nullptr;
+	if (!buffer)
+	{
+		const std::lock_guard<std::mutex> lock(mutex);
+		buffers.push_back(std::make_unique<trace_buffer>(trace_buffer{ static_cast<std::uint32_t>(buffers.size()), {} }));
+		buffer = buffers.back().get();
+	}
+	return *buffer;
+}
+
+inline std::int64_t trace_registry::now() const
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+inline void trace_registry::write(std::ostream& out)
+{
+	const std::lock_guard<std::mutex> lock(mutex);
+	out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+	bool first = true;
+	for (const auto& buffer : buffers)
+		for (const auto& event : buffer->events)
+		{
+			// the timestamps of the Chrome trace are in microseconds
+			out << (first ? "\n" : ",\n") << "{\"name\": \"" << event.name << "\", \"cat\": \"" << event.category << "\", \"ph\": \"X\", \"ts\": "
+				<< event.start_ns / 1000 << '.' << std::to_string(1000 + event.start_ns % 1000).substr(1) << ", \"dur\": " << event.duration_ns / 1000 << '.'
+				<< std::to_string(1000 + event.duration_ns % 1000).substr(1) << ", \"pid\": 1, \"tid\": " << buffer->thread << "}";
+			first = false;
+		}
+	out << "\n]}\n";
+}
+
+inline void trace_registry::clear()
+{
+	const std::lock_guard<std::mutex> lock(mutex);
+	for (const auto& buffer : buffers)
+		buffer->events.clear();
+}
+
+/**
+ * @brief Records the time from its construction to its destruction as a span of the calling thread, if the tracing is on
+ */
+class trace_span
+{
+public:
+	/**
+   * @brief Starts the span
+   * @param name The name of the span, a string literal
+   * @param category The category of the span, a string literal
+   */
+	explicit trace_span(const char* name, const char* category = "shanks");
+
+	trace_span(const trace_span&) = delete;
+	trace_span& operator=(const trace_span&) = delete;
+
+	/**
+   * @brief Ends the span and records it
+   */
+	~trace_span();
+
+private:
+	const char* name;
+	const char* category;
+	std::int64_t start_ns; // negative if the tracing was off when the span started
+};
+
+inline trace_span::trace_span(const char* name, const char* category) : name(name), category(category),
+	start_ns(trace_registry::instance().enabled.load(std::memory_order_relaxed) ? trace_registry::instance().now() : -1) {}
+
+inline trace_span::~trace_span()
+{
+	if (start_ns < 0)
+		return;
+	auto& registry = trace_registry::instance();
+	registry.thread_buffer().events.push_back({ name, category, start_ns, registry.now() - start_ns });
+}
+
+/**
+* @brief Starts recording the spans
+*/
+inline void start_tracing()
+{
+	trace_registry::instance().enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+* @brief Stops recording the spans, the recorded ones are kept
+*/
+inline void stop_tracing()
+{
+	trace_registry::instance().enabled.store(false, std::memory_order_relaxed);
+}
+
+/**
+* @brief Writes the recorded spans to a Chrome trace file
+* @param path The path of the file
+* @return Whether the file was written
+*/
+inline bool write_trace_file(const std::string& path)
+{
+	std::ofstream file(path);
+	if (!file)
+		return false;
+	trace_registry::instance().write(file);
+	return static_cast<bool>(file);
+}
+
+/**
+ * @brief Records the spans of its lifetime and writes them to a file at the end, it does nothing unless SHANKS_TRACING is defined
+ */
+class trace_session
+{
+public:
+	/**
+   * @brief Starts recording the spans
+   * @param path The path of the Chrome trace file, nothing is recorded if it is empty
+   */
+	explicit trace_session(const std::string& path);
+
+	trace_session(const trace_session&) = delete;
+	trace_session& operator=(const trace_session&) = delete;
+
+	/**
+   * @brief Stops recording the spans and writes them to the file
+   */
+	~trace_session();
+
+private:
+	std::string path;
+};
+
+#define SHANKS_TRACE_CONCAT_IMPL(a, b) a##b
+#define SHANKS_TRACE_CONCAT(a, b) SHANKS_TRACE_CONCAT_IMPL(a, b)
+#ifdef SHANKS_TRACING
+constexpr bool tracing_enabled = true;
+#define SHANKS_TRACE_SPAN(name) const trace_span SHANKS_TRACE_CONCAT(trace_span_, __LINE__)(name)
+#else
+constexpr bool tracing_enabled = false;
+#define SHANKS_TRACE_SPAN(name) ((void)0)
+#endif
+
+inline trace_session::trace_session(const std::string& path) : path(tracing_enabled ? path : std::string())
+{
+	if (!this->path.empty())
+		start_tracing();
+}
+
+inline trace_session::~trace_session()
+{
+	if (path.empty())
+		return;
+	stop_tracing();
+	write_trace_file(path);
+}